@@ -0,0 +1,51 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <new>
+
+/*
+    Clase: Arena
+    Descripcion: Allocador por bloques (arena). Reparte memoria de bloques grandes y
+                 contiguos avanzando un puntero, por lo que los nodos creados uno tras otro
+                 quedan juntos en memoria. No libera objetos individuales: reset() descarta
+                 todo lo asignado en O(1) y conserva los bloques para reutilizarlos en la
+                 siguiente construcción. Sólo debe usarse con tipos cuyo destructor no
+                 libere recursos (los destructores no se llaman).
+*/
+class Arena {
+public:
+    explicit Arena(size_t chunkBytes = 64 * 1024);
+    ~Arena();
+
+    void* allocate(size_t bytes, size_t alignment);
+    void reset();
+
+    template <typename T, typename... Args>
+    T* create(Args... args) {
+        return new (allocate(sizeof(T), alignof(T))) T(args...);
+    }
+
+    template <typename T>
+    T* allocateArray(int count) {
+        return static_cast<T*>(allocate(sizeof(T) * (count > 0 ? count : 1), alignof(T)));
+    }
+
+private:
+    struct Chunk {
+        Chunk* next;
+        size_t size;          // Bytes útiles del bloque (sin contar el encabezado)
+    };
+
+    Chunk* first;
+    Chunk* current;
+    size_t offset;            // Bytes ocupados del bloque actual
+    size_t chunkBytes;
+
+    Arena(const Arena&);
+    Arena& operator=(const Arena&);
+    static char* dataOf(Chunk* chunk);
+    Chunk* newChunk(size_t minBytes);
+};
+
+#endif // ARENA_HPP
@@ -0,0 +1,50 @@
+#ifndef BITS_HPP
+#define BITS_HPP
+
+/*
+    funcion: bitMasBajo
+    Descripcion: Posición del bit encendido menos significativo de una palabra de 64 bits.
+                 Con GCC/Clang usa __builtin_ctzll (una instrucción); con otros
+                 compiladores recorre los bits.
+    Parametros:
+        - palabra: Palabra con al menos un bit encendido
+    Return: Posición del bit (0 a 63)
+    Complejidad: O(1) con el builtin, O(64) con el ciclo
+*/
+inline int bitMasBajo(unsigned long long palabra) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(palabra);
+#else
+    int posicion = 0;
+    while ((palabra & 1ULL) == 0) {
+        palabra >>= 1;
+        posicion++;
+    }
+    return posicion;
+#endif
+}
+
+/*
+    funcion: contarBits
+    Descripcion: Número de bits encendidos de una palabra de 64 bits (popcount).
+                 Con GCC/Clang usa __builtin_popcountll; con otros compiladores apaga
+                 el bit más bajo hasta dejar la palabra en 0.
+    Parametros:
+        - palabra: Palabra a contar
+    Return: Bits encendidos (0 a 64)
+    Complejidad: O(1) con el builtin, O(bits encendidos) con el ciclo
+*/
+inline int contarBits(unsigned long long palabra) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(palabra);
+#else
+    int cuenta = 0;
+    while (palabra != 0) {
+        palabra &= palabra - 1;
+        cuenta++;
+    }
+    return cuenta;
+#endif
+}
+
+#endif // BITS_HPP
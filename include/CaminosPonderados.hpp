@@ -0,0 +1,52 @@
+#ifndef CAMINOSPONDERADOS_HPP
+#define CAMINOSPONDERADOS_HPP
+
+#include "Graph.hpp"
+#include "MonticuloIndexado.hpp"
+
+/*
+    class: CaminosPonderados
+    Descripcion: Caminos más cortos con peso entre dos nodos del grafo (Dijkstra normal y
+                 bidireccional) sobre el CSR. Cada arista cuesta 1 / pedidos, así que el
+                 camino más "corto" es el de conexiones más fuertes: pasa por las relaciones
+                 Platillo-Restaurante más pedidas.
+                 Los arreglos de trabajo (distancias, padres, montículos) se guardan entre
+                 consultas y sólo crecen cuando crece el grafo. Las distancias se invalidan
+                 con una marca de época en lugar de reiniciarlas, así que una consulta sólo
+                 cuesta lo que explora.
+*/
+class CaminosPonderados {
+public:
+    CaminosPonderados();
+    ~CaminosPonderados();
+
+    static double costoArista(int peso);
+
+    int dijkstra(const Graph& grafo, int origen, int destino, int* camino, int capacidad, double& costo);
+    int dijkstraBidireccional(const Graph& grafo, int origen, int destino, int* camino, int capacidad, double& costo);
+    void imprimirCamino(const Graph& grafo, int origen, int destino, bool bidireccional);
+
+private:
+    static const int ADELANTE = 0;
+    static const int ATRAS = 1;
+
+    int capacidad;
+    double* distancia[2];   // Distancia desde el origen (ADELANTE) o hacia el destino (ATRAS)
+    int* padre[2];          // Nodo anterior en el camino de cada búsqueda
+    int* alcanzado[2];      // == epoca si la distancia es válida en esta consulta
+    int* cerrado[2];        // == epoca si la distancia ya es definitiva
+    int epoca;
+    int nodosExplorados;    // Nodos cerrados en la última consulta
+    MonticuloIndexado monticulo[2];
+    int* bufferCamino;      // Camino de imprimirCamino, reutilizado entre consultas
+    int capacidadBuffer;
+
+    CaminosPonderados(const CaminosPonderados&);
+    CaminosPonderados& operator=(const CaminosPonderados&);
+
+    void prepararConsulta(int numNodos);
+    void alcanzar(int lado, int nodo, double nuevaDistancia, int nodoPadre);
+    int reconstruir(int ultimoAdelante, int primeroAtras, int* camino, int capacidadCamino) const;
+};
+
+#endif // CAMINOSPONDERADOS_HPP
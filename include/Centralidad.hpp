@@ -0,0 +1,104 @@
+#ifndef CENTRALIDAD_HPP
+#define CENTRALIDAD_HPP
+
+#include "Graph.hpp"
+#include "RankingTree.hpp"
+
+/*
+    struct: NodoCentral
+    Descripcion: Puntajes de centralidad de un nodo del grafo. Es el catálogo de los
+                 rankings de centralidad (el ID del elemento es el ID del nodo).
+    Campos:
+        - nombre / tipo: Copia del nombre y tipo ('P' o 'R') del nodo.
+        - gradoPonderado: Suma de los pesos de sus aristas (pedidos).
+        - cercania: Closeness de Wasserman-Faust: (r - 1) / (V - 1) * (r - 1) / suma de
+                    distancias, con r = nodos alcanzables (incluido él). Vale 0 si está aislado.
+        - intermediacion: Betweenness: suma, sobre todos los pares (s, t), de la fracción de
+                          caminos más cortos de s a t que pasan por el nodo.
+*/
+struct NodoCentral {
+    String nombre;
+    char tipo;
+    int gradoPonderado;
+    double cercania;
+    double intermediacion;
+
+    NodoCentral();
+    String getName() const;
+};
+
+/*
+    struct: WeightedDegreeKey / ClosenessKey / BetweennessKey
+    Descripcion: Llaves de los rankings de centralidad (ver RankingTree).
+*/
+struct WeightedDegreeKey {
+    static int keyOf(const NodoCentral& nodo) { return nodo.gradoPonderado; }
+    static const char* keyLabel() { return "Grado ponderado"; }
+    static const char* itemsLabel() { return "Nodos"; }
+};
+
+struct ClosenessKey {
+    static double keyOf(const NodoCentral& nodo) { return nodo.cercania; }
+    static const char* keyLabel() { return "Cercanía"; }
+    static const char* itemsLabel() { return "Nodos"; }
+};
+
+struct BetweennessKey {
+    static double keyOf(const NodoCentral& nodo) { return nodo.intermediacion; }
+    static const char* keyLabel() { return "Intermediación"; }
+    static const char* itemsLabel() { return "Nodos"; }
+};
+
+typedef RankingTree<NodoCentral, int, WeightedDegreeKey> WeightedDegreeRanking;
+typedef RankingTree<NodoCentral, double, ClosenessKey> ClosenessRanking;
+typedef RankingTree<NodoCentral, double, BetweennessKey> BetweennessRanking;
+
+/*
+    enum: MetricaCentralidad
+    Descripcion: Métrica por la que se consulta el ranking de centralidad.
+*/
+enum MetricaCentralidad {
+    GRADO_PONDERADO,
+    CERCANIA,
+    INTERMEDIACION
+};
+
+/*
+    class: Centralidad
+    Descripcion: Calcula grado ponderado, cercanía (closeness) e intermediación (betweenness,
+                 algoritmo de Brandes) de todos los nodos del grafo y los guarda en rankings
+                 separados para platillos y restaurantes.
+                 Cercanía e intermediación usan distancias en saltos: un BFS por nodo de
+                 origen. Los orígenes se reparten entre hilos con un contador atómico y cada
+                 hilo acumula la intermediación en su propio arreglo; al final se suman.
+*/
+class Centralidad {
+public:
+    Centralidad();
+    ~Centralidad();
+
+    void calcular(const Graph& grafo, int numHilos = 0);
+    void limpiar();
+    bool estaCalculada() const;
+    int topN(MetricaCentralidad metrica, char tipo, int n, int* ids, int capacidad) const;
+    void imprimirTopN(MetricaCentralidad metrica, char tipo, int n) const;
+
+private:
+    int numNodos;
+    NodoCentral* nodos;
+    WeightedDegreeRanking gradoPlatillos;
+    WeightedDegreeRanking gradoRestaurantes;
+    ClosenessRanking cercaniaPlatillos;
+    ClosenessRanking cercaniaRestaurantes;
+    BetweennessRanking intermediacionPlatillos;
+    BetweennessRanking intermediacionRestaurantes;
+
+    Centralidad(const Centralidad&);
+    Centralidad& operator=(const Centralidad&);
+
+    void calcularCaminos(const GrafoCSR& g, int numHilos);
+    void construirRankings();
+    double valorDe(MetricaCentralidad metrica, int id) const;
+};
+
+#endif // CENTRALIDAD_HPP
@@ -10,6 +10,7 @@ public:
     String getName() const;
     int getTotalOrders() const;
     void addOrder();
+    void removeOrder();
 private:
     String name;
     int totalOrders = 0;
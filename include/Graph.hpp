@@ -2,6 +2,7 @@
 #define GRAPH_HPP
 
 #include "CustomString.hpp"
+#include "Arena.hpp"
 
 /*
     struct: NodoAdyacencia
@@ -11,6 +12,7 @@
         - idDestino: El ID numérico del restaurante/platillo al que apunta.
         - peso: Cuántas veces se ha pedido ese platillo en ese restaurante.
         - siguiente: Puntero al siguiente nodo en la lista.
+    Los nodos se crean en la arena del Graph, por lo que no se liberan uno por uno.
 */
 struct NodoAdyacencia {
     int idDestino;
@@ -29,17 +31,52 @@ struct NodoAdyacencia {
         - nombre: El texto identificador (ej. "Pizza", "Dominos").
         - tipo: 'P' (Platillo) o 'R' (Restaurante).
         - cabezaLista: Inicio de la lista de conexiones (adyacencias).
+        - grado: Número de vecinos distintos (se actualiza al agregar aristas).
+        - pesoTotal: Suma de los pesos de sus aristas (pedidos).
 */
 struct Vertice {
     String nombre;
     char tipo;
     NodoAdyacencia* cabezaLista;
+    int grado;
+    int pesoTotal;
     Vertice();
     Vertice(const String& nom, char t);
     ~Vertice();
     void limpiarLista();
 };
 
+/*
+    struct: GrafoCSR
+    Descripcion: Forma "congelada" del grafo en formato CSR (Compressed Sparse Row).
+                 Las adyacencias de todos los vértices quedan en arreglos contiguos, así
+                 que los recorridos leen memoria secuencial en lugar de seguir punteros.
+    Campos:
+        - offsets: numNodos + 1 entradas; los vecinos del nodo i están en
+                   [offsets[i], offsets[i + 1]).
+        - vecinos: IDs destino de todas las aristas, agrupados por nodo origen.
+        - pesos: Peso de cada arista, paralelo a vecinos.
+        - numNodos / numAristas: Tamaño actual (cada arista bidireccional cuenta 2 veces).
+*/
+struct GrafoCSR {
+    int* offsets;
+    int* vecinos;
+    int* pesos;
+    int numNodos;
+    int numAristas;
+    int capacidadNodos;
+    int capacidadAristas;
+
+    GrafoCSR();
+    ~GrafoCSR();
+    void reservar(int nodos, int aristas);
+    int grado(int nodo) const;
+
+private:
+    GrafoCSR(const GrafoCSR&);
+    GrafoCSR& operator=(const GrafoCSR&);
+};
+
 /*
     class: Graph
     Descripcion: Grafo BIDIRECCIONAL (no dirigido) implementado con listas de adyacencia enlazadas.
@@ -48,8 +85,23 @@ struct Vertice {
     CARACTERÍSTICAS:
     - Grafo BIDIRECCIONAL: Conectamos Platillo <-> Restaurante en ambas direcciones
     - Listas enlazadas manuales (sin std::vector)
-    - Soporta BFS y DFS
-    - Manejo manual de memoria con new/delete
+    - Soporta BFS y DFS (además de un BFS paralelo de dirección optimizada que sólo calcula niveles)
+    - Las consultas recorren una copia CSR del grafo (ver GrafoCSR). Las listas enlazadas
+      sólo se usan mientras se construye; construirCSR() congela el resultado y cualquier
+      modificación posterior invalida la copia, que se reconstruye al siguiente recorrido
+    - Arreglo de vértices dinámico: se reserva hasta el primer nodo y crece al doble,
+      sin límite fijo de nodos
+    - Índice hash (nombre, tipo) -> ID con direccionamiento abierto, para que buscar o crear
+      un nodo cueste O(1) esperado en lugar de recorrer todos los vértices
+    - Índice hash de aristas con llave (origen, destino) empacada en 64 bits, para que
+      incrementar el peso de una arista existente no recorra la lista del nodo
+    - Los nodos de adyacencia salen de una arena: quedan contiguos en memoria y
+      limpiarGrafo() los libera todos de una vez
+    - Componentes conexas con union-find (unión por tamaño + compresión de caminos)
+      actualizadas en cada agregarArista, así que el número de componentes, la más grande
+      y los nodos aislados se consultan sin recorrer el grafo
+    - Grado y peso de cada vértice, totales globales y el platillo/restaurante más
+      conectado se mantienen en agregarArista, así que las estadísticas cuestan O(1)
 */
 class Graph {
 public:
@@ -57,26 +109,92 @@ public:
     int obtenerOcrearNodo(const String& nombre, char tipo);
     NodoAdyacencia* buscarArista(int idOrigen, int idDestino) const;
     void agregarArista(int idOrigen, int idDestino);  // Bidireccional
+    void construirCSR();
+    const GrafoCSR& obtenerCSR() const;
     void ejecutarBFS(int nodoInicio) const;
+    int calcularNivelesBFS(int nodoInicio, int* distancias, int numHilos = 0) const;
+    int calcularNivelesBFS(const GrafoCSR& g, int nodoInicio, int* distancias, int numHilos = 0) const;
+    void imprimirNiveles(int nodoInicio) const;
+    void imprimirNiveles(const GrafoCSR& g, int nodoInicio) const;
     void ejecutarDFS(int nodoInicio) const;
+    int recorridoDFS(int nodoInicio, int* orden, int capacidad) const;
+    int vecindarioKSaltos(int nodoInicio, int maxSaltos, int maxResultados, int pesoMinimo, char tipo,
+                          int* resultados, int* saltos) const;
+    int buscarComponente(int id) const;
+    bool mismoComponente(int idA, int idB) const;
+    int getNumComponentes() const;
+    int getTamanoComponente(int id) const;
+    int getComponenteMasGrande() const;
+    int getPlatillosAislados() const;
+    int getRestaurantesAislados() const;
+    void imprimirComponentes() const;
     int buscarNodoPorNombre(const String& nombre) const;
+    int buscarNodo(const String& nombre, char tipo) const;
     void imprimirGrafo() const;
     void imprimirEstadisticas() const;
     void obtenerRestaurantesDePlatillo(const String& nombrePlatillo) const;
     void obtenerPlatilloMasConectado() const;
     int getNumNodos() const;
+    int getGradoNodo(int id) const;
+    int getPesoNodo(int id) const;
     String getNombreNodo(int id) const;
     char getTipoNodo(int id) const;
     void limpiarGrafo();
     ~Graph();
 
 private:
-    static const int MAX_NODOS = 15000;
+    static const int ALFA_BFS = 14;   // Cambiar a abajo-arriba si aristas(frontera) > aristas(sin visitar) / ALFA
+    static const int BETA_BFS = 24;   // Regresar a arriba-abajo si nodos(frontera) < V / BETA
+    static const int RANGOS_TAMANO = 32;  // Rangos [2^k, 2^(k+1)) del histograma de componentes
+    
     Vertice* grafo;
     int numNodos;
+    int capacidadNodos;       // Vértices reservados en 'grafo'
+    Arena arenaAristas;       // Memoria de todos los NodoAdyacencia del grafo
+    int numAristasDirigidas;  // Total de NodoAdyacencia (cada arista cuenta 2 veces)
+    long long pesoTotalDirigido;  // Suma de todos los pesos (cada arista cuenta 2 veces)
+    int numPlatillos;
+    int numRestaurantes;
+    int platilloMasConectado;     // ID del platillo con más restaurantes (desempate: más pedidos), -1 si no hay
+    int restauranteMasConectado;  // ID del restaurante con más platillos, -1 si no hay
+    mutable GrafoCSR csr;     // Copia congelada para los recorridos
+    mutable bool csrValido;
+    int* indiceIds;           // Tabla hash (sondeo lineal): ID del vértice o -1 si la casilla está libre
+    unsigned int* indiceHashes;  // Hash guardado de cada casilla, para comparar nombres sólo si coincide
+    int capacidadIndice;      // Potencia de 2
+    unsigned long long* indiceAristasLlaves;  // Llave (origen << 32 | destino) de cada casilla
+    NodoAdyacencia** indiceAristasNodos;      // Arista de cada casilla, nullptr si está libre
+    int capacidadIndiceAristas;               // Potencia de 2
+    mutable int* pilaNodos;       // Pila explícita del DFS (se reutiliza entre recorridos)
+    mutable int* pilaCursores;    // Siguiente posición del CSR por revisar de cada nodo en la pila
+    mutable bool* visitados;      // Marcas de visitado reutilizables
+    mutable int* marcasRecorrido; // Época en que se visitó cada nodo (no hay que limpiarlas)
+    mutable int epocaRecorrido;
+    mutable int capacidadRecorrido;
+    mutable int* padreComponente;  // Union-find: padre de cada nodo (la raíz es su propio padre)
+    int* tamanoComponente;         // Nodos de la componente, válido sólo en las raíces
+    int numComponentes;
+    int raizMasGrande;             // Raíz de la componente más grande, -1 si no hay nodos
+    int componentesPorRango[RANGOS_TAMANO];  // Componentes con tamaño en [2^k, 2^(k+1))
+    int platillosAislados;         // Platillos sin ninguna arista
+    int restaurantesAislados;      // Restaurantes sin ninguna arista
     
-    void dfsRecursivo(int nodo, bool* visitado) const;
+    void crecerVertices(int minimo);
+    static unsigned int hashNombre(const String& nombre, char tipo);
+    int buscarEnIndice(const String& nombre, char tipo) const;
+    void insertarEnIndice(int id);
+    void crecerIndice();
+    static unsigned long long llaveArista(int idOrigen, int idDestino);
+    static unsigned int hashArista(unsigned long long llave);
+    void insertarEnIndiceAristas(unsigned long long llave, NodoAdyacencia* arista);
+    void crecerIndiceAristas();
+    void llenarCSR(GrafoCSR& destino) const;
+    void asegurarEspacioRecorrido() const;
     void agregarAristaUnidireccional(int idOrigen, int idDestino);  // Función auxiliar
+    void unirComponentes(int idA, int idB);
+    bool estaMasConectado(int idA, int idB) const;
+    void actualizarMasConectado(int id);
+    static int rangoDeTamano(int tamano);
 };
 
 #endif // GRAPH_HPP
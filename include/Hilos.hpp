@@ -0,0 +1,64 @@
+#ifndef HILOS_HPP
+#define HILOS_HPP
+
+#include <thread>
+
+/*
+    funcion: numeroDeHilos
+    Descripcion: Decide cuántos hilos usar para un algoritmo paralelo.
+    Parametros:
+        - solicitados: Hilos pedidos por el usuario; 0 o menos usa todos los núcleos.
+    Return: Número de hilos (al menos 1)
+    Complejidad: O(1)
+*/
+inline int numeroDeHilos(int solicitados) {
+    if (solicitados > 0) return solicitados;
+    const unsigned int nucleos = std::thread::hardware_concurrency();
+    return nucleos > 0 ? static_cast<int>(nucleos) : 1;
+}
+
+/*
+    funcion: hilosParaTrabajo
+    Descripcion: Limita los hilos según la cantidad de trabajo, para no pagar el costo de
+                 crear hilos cuando hay poco que repartir.
+    Parametros:
+        - hilos: Máximo de hilos disponibles
+        - trabajo: Unidades de trabajo (nodos, aristas, ...)
+        - minimoPorHilo: Unidades mínimas que justifican un hilo
+    Return: Número de hilos a usar (al menos 1)
+    Complejidad: O(1)
+*/
+inline int hilosParaTrabajo(int hilos, long long trabajo, long long minimoPorHilo) {
+    const long long utiles = trabajo / minimoPorHilo;
+    if (utiles < 1) return 1;
+    return utiles < hilos ? static_cast<int>(utiles) : hilos;
+}
+
+/*
+    funcion: ejecutarEnHilos
+    Descripcion: Ejecuta trabajo(h) para h = 0 .. hilos-1, cada uno en su propio hilo
+                 (el hilo 0 es el que llama), y espera a que todos terminen.
+    Parametros:
+        - hilos: Número de hilos
+        - trabajo: Función o lambda que recibe el índice del hilo
+    Complejidad: O(hilos) más el costo del trabajo
+*/
+template <typename Trabajo>
+void ejecutarEnHilos(int hilos, const Trabajo& trabajo) {
+    if (hilos <= 1) {
+        trabajo(0);
+        return;
+    }
+
+    std::thread* grupo = new std::thread[hilos - 1];
+    for (int h = 1; h < hilos; ++h) {
+        grupo[h - 1] = std::thread([&trabajo, h]() { trabajo(h); });
+    }
+    trabajo(0);
+    for (int h = 1; h < hilos; ++h) {
+        grupo[h - 1].join();
+    }
+    delete[] grupo;
+}
+
+#endif // HILOS_HPP
@@ -0,0 +1,20 @@
+#ifndef HOURSLOT_HPP
+#define HOURSLOT_HPP
+
+#include "CustomString.hpp"
+
+class HourSlot {
+public:
+    HourSlot();
+    HourSlot(int hour);
+    String getName() const;
+    int getHour() const;
+    int getTotalOrders() const;
+    void addOrder();
+    void removeOrder();
+private:
+    int hour = 0;
+    int totalOrders = 0;
+};
+
+#endif
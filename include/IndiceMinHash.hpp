@@ -0,0 +1,75 @@
+#ifndef INDICEMINHASH_HPP
+#define INDICEMINHASH_HPP
+
+#include "Graph.hpp"
+
+/*
+    struct: RestauranteSimilar
+    Descripcion: Resultado de una consulta al índice MinHash.
+    Campos:
+        - restaurante: ID del restaurante en el grafo.
+        - similitud: Índice de Jaccard exacto entre los menús (0 a 1).
+        - compartidos: Platillos que venden ambos restaurantes.
+*/
+struct RestauranteSimilar {
+    int restaurante;
+    float similitud;
+    int compartidos;
+};
+
+/*
+    class: IndiceMinHash
+    Descripcion: Índice de menús parecidos entre restaurantes.
+                 Cada restaurante se resume con una firma MinHash de NUM_HASHES valores
+                 sobre su conjunto de platillos; la probabilidad de que dos firmas coincidan
+                 en una posición es el índice de Jaccard de sus menús.
+                 Las firmas se parten en BANDAS bandas de FILAS_POR_BANDA valores (LSH):
+                 dos restaurantes son candidatos si coinciden en una banda completa, así que
+                 una consulta sólo revisa las cubetas de sus bandas en lugar de todos los
+                 restaurantes. Los candidatos se ordenan con su Jaccard exacto.
+                 Con 32 bandas de 2 valores el umbral (Jaccard con 50% de probabilidad de
+                 ser candidato) es (1/32)^(1/2) ~ 0.18: los menús reales se parecen a lo más
+                 ~0.38, así que con bandas más largas casi ningún par sería candidato. Los
+                 pares por debajo del umbral pueden no aparecer, y una consulta puede
+                 devolver menos resultados de los pedidos.
+*/
+class IndiceMinHash {
+public:
+    IndiceMinHash();
+    ~IndiceMinHash();
+
+    void construir(const Graph& grafo, int numHilos = 0);
+    void limpiar();
+    int buscarSimilares(const Graph& grafo, int nodo, RestauranteSimilar* resultado, int capacidad) const;
+    void imprimirSimilares(const Graph& grafo, int nodo, int n) const;
+
+private:
+    static const int BANDAS = 32;
+    static const int FILAS_POR_BANDA = 2;
+    static const int NUM_HASHES = BANDAS * FILAS_POR_BANDA;
+
+    int numNodos;
+    int numFilas;                  // Restaurantes indexados
+    int* filaDeNodo;               // Fila de cada nodo del grafo, -1 si no es restaurante
+    int* nodoDeFila;               // Nodo del grafo de cada fila
+    unsigned int* firmas;          // numFilas * NUM_HASHES valores
+    unsigned long long* llavesBanda;  // Llave de cada (banda, fila)
+    int* cabezasCubeta;            // BANDAS tablas de capacidadCubetas cabezas de lista (-1 = vacía)
+    int* siguienteEnCubeta;        // Siguiente fila en la misma cubeta, por (banda, fila)
+    int capacidadCubetas;          // Potencia de 2
+    unsigned long long multiplicadores[NUM_HASHES];
+    unsigned long long sumandos[NUM_HASHES];
+    mutable int* marcas;           // Época en que se vio cada fila como candidata
+    mutable int epoca;
+    mutable bool* enMenu;          // Platillos del restaurante consultado (por nodo del grafo)
+
+    IndiceMinHash(const IndiceMinHash&);
+    IndiceMinHash& operator=(const IndiceMinHash&);
+
+    static unsigned long long mezclar(unsigned long long valor);
+    unsigned long long llaveDeBanda(int fila, int banda) const;
+    int contarCompartidos(const GrafoCSR& g, int nodo) const;
+    static bool esMasParecido(const RestauranteSimilar& a, const RestauranteSimilar& b);
+};
+
+#endif // INDICEMINHASH_HPP
@@ -0,0 +1,53 @@
+#ifndef INDICESIMILITUD_HPP
+#define INDICESIMILITUD_HPP
+
+#include "Graph.hpp"
+
+/*
+    struct: ParSimilar
+    Descripcion: Un platillo parecido a otro dentro del índice de similitud.
+    Campos:
+        - platillo: ID del platillo similar en el grafo.
+        - compartidos: Número de restaurantes que venden ambos platillos.
+        - similitud: Índice de Jaccard de sus conjuntos de restaurantes (0 a 1).
+*/
+struct ParSimilar {
+    int platillo;
+    int compartidos;
+    float similitud;
+};
+
+/*
+    class: IndiceSimilitud
+    Descripcion: Proyección Platillo-Platillo del grafo bipartito: para cada platillo guarda
+                 los K platillos que más se venden en los mismos restaurantes.
+                 Se calcula como el producto de matrices dispersas A * A^T (A = adyacencia
+                 Platillo -> Restaurante) fila por fila (algoritmo de Gustavson), repartiendo
+                 las filas entre hilos y quedándose sólo con el top K de cada fila.
+                 El resultado se guarda en formato CSR: los similares del nodo i están en
+                 pares[offsets[i] .. offsets[i + 1]), ordenados de más a menos parecido.
+*/
+class IndiceSimilitud {
+public:
+    IndiceSimilitud();
+    ~IndiceSimilitud();
+
+    void construir(const Graph& grafo, int k, int numHilos = 0);
+    void limpiar();
+    bool estaConstruido() const;
+    int obtenerSimilares(int nodo, const ParSimilar*& similares) const;
+    void imprimirSimilares(const Graph& grafo, int nodo) const;
+
+private:
+    int* offsets;
+    ParSimilar* pares;
+    int numNodos;
+    int topK;
+
+    IndiceSimilitud(const IndiceSimilitud&);
+    IndiceSimilitud& operator=(const IndiceSimilitud&);
+
+    static bool esMasSimilar(const ParSimilar& a, const ParSimilar& b);
+};
+
+#endif // INDICESIMILITUD_HPP
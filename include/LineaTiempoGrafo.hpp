@@ -0,0 +1,55 @@
+#ifndef LINEATIEMPOGRAFO_HPP
+#define LINEATIEMPOGRAFO_HPP
+
+#include "Graph.hpp"
+
+/*
+    class: LineaTiempoGrafo
+    Descripcion: Historia por día de las aristas del grafo Platillo-Restaurante, para
+                 consultar el grafo de un rango de fechas sin volver a procesar las órdenes.
+                 Los pedidos se registran como eventos (platillo, restaurante, día) mientras
+                 se cargan; construir() los ordena y deja, para cada arista dirigida, la
+                 lista de días con pedidos y los pedidos acumulados hasta cada día (formato
+                 CSR, con los mismos IDs de nodo que el Graph).
+                 El peso de una arista en [diaInicio, diaFin] es la resta de dos acumulados,
+                 así que sale con dos búsquedas binarias sobre su serie.
+                 Los días son cualquier entero ordenado (ej. MMDD).
+*/
+class LineaTiempoGrafo {
+public:
+    LineaTiempoGrafo();
+    ~LineaTiempoGrafo();
+
+    void registrarPedido(int idPlatillo, int idRestaurante, int dia);
+    void construir(int numNodos);
+    void limpiar();
+    bool estaConstruida() const;
+    int vecinosEnVentana(int nodo, int diaInicio, int diaFin, int* vecinosEnRango, int* pesosEnRango, int capacidad) const;
+    void construirVentana(int diaInicio, int diaFin, GrafoCSR& destino) const;
+
+private:
+    // Eventos registrados (cada uno es una arista no dirigida)
+    int* eventosPlatillo;
+    int* eventosRestaurante;
+    int* eventosDia;
+    int numEventos;
+    int capacidadEventos;
+
+    // Series por arista dirigida (CSR); las aristas de cada nodo van ordenadas por vecino
+    int numNodos;
+    int* offsets;       // numNodos + 1; las aristas del nodo i están en [offsets[i], offsets[i + 1])
+    int* vecinos;       // Destino de cada arista
+    int* inicioSerie;   // numAristas + 1; los días de la arista k están en [inicioSerie[k], inicioSerie[k + 1])
+    int* dias;          // Días con pedidos, ascendentes dentro de cada serie
+    int* acumulados;    // Pedidos de la arista desde su primer día hasta dias[j], inclusive
+    int numAristas;
+
+    LineaTiempoGrafo(const LineaTiempoGrafo&);
+    LineaTiempoGrafo& operator=(const LineaTiempoGrafo&);
+
+    void liberarSeries();
+    int pedidosHasta(int arista, int dia) const;
+    int pesoDeArista(int arista, int diaInicio, int diaFin) const;
+};
+
+#endif // LINEATIEMPOGRAFO_HPP
@@ -0,0 +1,60 @@
+#ifndef MATRIZMENUS_HPP
+#define MATRIZMENUS_HPP
+
+#include "Graph.hpp"
+
+/*
+    struct: ParRestaurantes
+    Descripcion: Dos restaurantes y qué tanto se parecen sus menús.
+    Campos:
+        - restauranteA, restauranteB: IDs en el grafo (restauranteA < restauranteB).
+        - compartidos: Platillos que venden ambos.
+        - similitud: Índice de Jaccard de los menús (0 a 1).
+*/
+struct ParRestaurantes {
+    int restauranteA;
+    int restauranteB;
+    int compartidos;
+    float similitud;
+};
+
+/*
+    class: MatrizMenus
+    Descripcion: Matriz de adyacencia densa Restaurante x Platillo en bits: cada restaurante
+                 es una fila con un bit por platillo. Como hay pocos restaurantes comparados
+                 con los platillos, la matriz completa cabe en caché y comparar dos menús es
+                 un AND de dos filas más un popcount.
+                 El conteo usa AVX2 (popcount por nibbles con tabla en registro) cuando el
+                 procesador lo soporta, detectado en tiempo de ejecución; si no, usa el
+                 popcount escalar de 64 bits.
+*/
+class MatrizMenus {
+public:
+    MatrizMenus();
+    ~MatrizMenus();
+
+    void construir(const Graph& grafo);
+    void limpiar();
+    int paresMasParecidos(ParRestaurantes* resultado, int capacidad, int numHilos = 0) const;
+    void imprimirParesMasParecidos(const Graph& grafo, int n) const;
+
+private:
+    typedef unsigned long long Palabra;
+    static const int PALABRAS_POR_BLOQUE = 4;  // 256 bits: las filas se rellenan a este múltiplo
+
+    int numNodos;
+    int numFilas;          // Restaurantes
+    int palabrasPorFila;   // Múltiplo de PALABRAS_POR_BLOQUE
+    Palabra* bits;         // numFilas * palabrasPorFila
+    int* tamanos;          // Platillos de cada fila (popcount de la fila)
+    int* filaDeNodo;       // Fila de cada nodo del grafo, -1 si no es restaurante
+    int* nodoDeFila;       // Nodo del grafo de cada fila
+
+    MatrizMenus(const MatrizMenus&);
+    MatrizMenus& operator=(const MatrizMenus&);
+
+    int interseccion(int filaA, int filaB) const;
+    static bool esMasParecido(const ParRestaurantes& a, const ParRestaurantes& b);
+};
+
+#endif // MATRIZMENUS_HPP
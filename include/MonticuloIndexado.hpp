@@ -0,0 +1,41 @@
+#ifndef MONTICULOINDEXADO_HPP
+#define MONTICULOINDEXADO_HPP
+
+/*
+    class: MonticuloIndexado
+    Descripcion: Montículo binario de mínimos sobre IDs de nodo (0 a capacidad - 1) con
+                 índice inverso: posicion[id] dice dónde está cada ID dentro del montículo,
+                 así que bajar la clave de un nodo ya insertado es O(log n) sin buscarlo.
+                 Es la cola de prioridad de Dijkstra. Entre consultas sólo se vacía (no se
+                 libera): posicion queda en -1 para todos los IDs y la memoria se reutiliza.
+*/
+class MonticuloIndexado {
+public:
+    MonticuloIndexado();
+    ~MonticuloIndexado();
+
+    void reservar(int capacidad);
+    void vaciar();
+    bool vacio() const;
+    int getTamano() const;
+    bool contiene(int id) const;
+    void insertarOReducir(int id, double clave);
+    int extraerMinimo();
+    double claveMinima() const;
+
+private:
+    int* ids;          // ids[i]: ID en la posición i del montículo
+    double* claves;    // claves[i]: prioridad del ID en la posición i
+    int* posicion;     // posicion[id]: posición del ID, -1 si no está
+    int tamano;
+    int capacidad;
+
+    MonticuloIndexado(const MonticuloIndexado&);
+    MonticuloIndexado& operator=(const MonticuloIndexado&);
+
+    void subir(int i);
+    void bajar(int i);
+    void colocar(int i, int id, double clave);
+};
+
+#endif // MONTICULOINDEXADO_HPP
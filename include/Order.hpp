@@ -5,12 +5,15 @@
 class Order {
 public:
     Order();
-    Order(String date, String restaurant, String order, int pric, long long numberDate);
+    Order(String date, String restaurant, String order, int pric, long long numberDate,
+          int dishId = -1, int restaurantId = -1);
     String getDate() const;
     String getRestaurant() const;
     String getOrder() const;
     int getPrice() const;
     long long getNumberDate() const;
+    int getDishId() const;
+    int getRestaurantId() const;
 
     /* Operadores sobrecargados; El fin de sobrecargar los operadores "<>" es para poder usar en condicionales de los
      * ciclos if - else, while y for comparaciones entre las fechas de dos objetos de tipo "Orden" */
@@ -23,6 +26,8 @@ private:
     String order; 
     long long numberDate; 
     int price;
+    short dishId;        // Índice del platillo en el catálogo de OrderManager (cabe en el
+    short restaurantId;  // relleno tras price, así Order sigue midiendo 64 bytes)
 };
 
 #endif 
\ No newline at end of file
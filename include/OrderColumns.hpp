@@ -0,0 +1,61 @@
+#ifndef ORDERCOLUMNS_HPP
+#define ORDERCOLUMNS_HPP
+#include "Order.hpp"
+
+/*
+    struct: OrderAggregate
+    Descripcion: Resumen de precios de un rango de órdenes.
+    Campos:
+        - count: Órdenes en el rango.
+        - revenue: Suma de precios.
+        - minPrice / maxPrice: Precio mínimo y máximo (0 si el rango está vacío).
+*/
+struct OrderAggregate {
+    int count;
+    long long revenue;
+    int minPrice;
+    int maxPrice;
+};
+
+/*
+    class: OrderColumns
+    Descripcion: Copia columnar (struct-of-arrays) de las órdenes ya ordenadas por fecha:
+                 un arreglo contiguo por campo (fecha numérica, precio, restaurante y
+                 platillo). Order guarda tres Strings por orden, así que recorrer fechas o
+                 precios en el arreglo de Order arrastra ~100 bytes por orden; aquí un
+                 recorrido de fecha + precio lee 12 bytes por orden.
+                 La fila i corresponde a orders[i] del OrderManager; se reconstruye cada vez
+                 que se ordenan las órdenes.
+*/
+class OrderColumns {
+public:
+    OrderColumns();
+    ~OrderColumns();
+
+    void build(const Order* orders, int count);
+    void clear();
+    int size() const;
+
+    long long getTimestamp(int row) const;
+    const int* priceColumn() const;
+    const int* restaurantColumn() const;
+
+    int lowerBound(long long timestamp) const;
+    int upperBound(long long timestamp) const;
+    OrderAggregate aggregate(int first, int last) const;
+    void revenueByRestaurant(int first, int last, long long* revenue) const;
+    void ordersByDish(int first, int last, int* counts) const;
+
+private:
+    long long* timestamps;  // numberDate de cada orden (ordenado ascendente)
+    int* prices;
+    int* restaurantIds;
+    int* dishIds;
+    int rows;
+    int capacity;
+
+    OrderColumns(const OrderColumns&);
+    OrderColumns& operator=(const OrderColumns&);
+};
+
+#endif
@@ -1,21 +1,36 @@
 #ifndef ORDERMANAGER_HPP
 #define ORDERMANAGER_HPP
 #include <Order.hpp>
+#include <OrderColumns.hpp>
+#include <OrderScan.hpp>
 #include <Dish.hpp>
 #include <DishBST.hpp>
+#include <Restaurant.hpp>
+#include <HourSlot.hpp>
+#include <Rankings.hpp>
 #include <Graph.hpp>
+#include <IndiceSimilitud.hpp>
+#include <IndiceMinHash.hpp>
+#include <PageRankPersonalizado.hpp>
+#include <LineaTiempoGrafo.hpp>
+#include <MatrizMenus.hpp>
+#include <Centralidad.hpp>
+#include <CaminosPonderados.hpp>
 
 class OrderManager {
 public:
     // Constructor sin parametros
     OrderManager();
-    ~OrderManager() = default;
+    ~OrderManager();
 
     // Metodos para el manejo del contenido de los archivos de texto
     bool loadOrders(const String & filename);
     void sortOrders();
     void filterOrdersByDate(const String & startDate,const String & endDate, bool details = true);
     void filterOrdersByDate(const char *startDate, const char *endDate, bool details = true);
+    void summarizeOrdersByDate(const String & startDate, const String & endDate);
+    void filterOrders(const String & startDate, const String & endDate, int minPrice, int maxPrice,
+                      const String & restaurantList, bool details = true);
     void displayOrders(size_t from, size_t count);
     // void saveToFile( String& filename) ;
 
@@ -25,6 +40,9 @@ public:
     //metodos para agregar dishes 
     void addDish(String name);
     Dish* findDish(String name);
+    int findDishIndex(const String& name) const;
+    int recordDishOrder(const String& name);
+    bool cancelDishOrder(const String& name);
     void printDishes() const;
     
     // Métodos para el BST de platillos
@@ -34,15 +52,39 @@ public:
     void printDishBSTReverse() const;
     void findAndPrintMostOrderedDishes() const;
     void findAndPrintTopNDishes(int n) const;
+    void printDishRank(const String& name) const;
+    void printDishesAtPercentile(double percentile) const;
+    void printDishCountInRange(int minOrders, int maxOrders) const;
+
+    // Métodos para los rankings de restaurantes y horas del día
+    int findRestaurantIndex(const String& name) const;
+    int recordRestaurantOrder(const String& name, int price);
+    void recordHourOrder(int hour);
+    void buildRankings();
+    void findAndPrintTopNRestaurantsByOrders(int n) const;
+    void findAndPrintTopNRestaurantsByRevenue(int n) const;
+    void printHourRanking() const;
     
     // Métodos para el Grafo de relaciones Platillo-Restaurante
+    void recordGraphOrder(int dishIndex, int restaurantIndex, int day);
     void buildGraph();
     void printGraph() const;
     void showGraphStatistics() const;
     void ejecutarBFSDesdeplatillo(const String& nombrePlatillo) const;
+    void mostrarAlcanceDesdePlatillo(const String& nombrePlatillo) const;
     void ejecutarDFSDesdeplatillo(const String& nombrePlatillo) const;
     void buscarRestaurantesDePlatillo(const String& nombrePlatillo) const;
     void mostrarPlatilloMasConectado() const;
+    void mostrarPlatillosSimilares(const String& nombrePlatillo) const;
+    void mostrarRestaurantesConMenuParecido(const String& nombreRestaurante, int n) const;
+    void mostrarParesDeRestaurantesParecidos(int n) const;
+    void recomendarPlatillosParaRestaurante(const String& nombreRestaurante, int n) const;
+    void recomendarRestaurantesParaPlatillo(const String& nombrePlatillo, int n) const;
+    void buscarRestaurantesDePlatilloEnFechas(const String& nombrePlatillo, const String& startDate, const String& endDate) const;
+    void mostrarAlcanceEnFechas(const String& nombrePlatillo, const String& startDate, const String& endDate) const;
+    void mostrarVecindario(const String& nombre, int maxSaltos, int maxResultados, int pesoMinimo, char tipo) const;
+    void mostrarCentralidad(MetricaCentralidad metrica, char tipo, int n) const;
+    void mostrarCaminoMasFuerte(const String& nombreOrigen, const String& nombreDestino, bool bidireccional) const;
     Graph& getGraph();
     const Graph& getGraph() const;
     
@@ -51,14 +93,51 @@ private:
     int findOrder(long long val,bool exact,bool last) const;
     int orderCount = 0;
     static const int MAX_ORDERS = 11000; 
+    static_assert(MAX_ORDERS <= 32767, "Order guarda los índices de catálogo en short");
     Order orders[MAX_ORDERS]; 
+    OrderColumns orderColumns;  // Fechas, precios e índices de orders en columnas (se arma en sortOrders)
+    OrderScan orderScan;        // Bitmap y tabla de restaurantes reutilizados por filterOrders
+    void parseDateRange(const String & startDate, const String & endDate, long long & start, long long & end) const;
     Dish dishes[MAX_ORDERS];
     DishBST dishBST;
+    mutable int* rankingBuffer = nullptr;   // Buffer reutilizable para las consultas de ranking
+    mutable int rankingBufferCapacity = 0;
+    int* rankingScratch(int needed) const;
+    static const int HOURS_PER_DAY = 24;
+    Restaurant* restaurants = nullptr;      // Catálogo de restaurantes; crece al registrar uno nuevo
+    int restaurantsCount = 0;
+    int restaurantsCapacity = 0;
+    HourSlot hourSlots[HOURS_PER_DAY];
+    RestaurantOrdersRanking restaurantOrdersRanking;
+    RestaurantRevenueRanking restaurantRevenueRanking;
+    HourRanking hourRanking;
+    bool rankingsBuilt = false;
+    bool dishBSTBuilt = false;
     Graph dishRestaurantGraph;
+    int* dishNodeIds = nullptr;         // Vértice de cada platillo en el grafo
+    int dishNodeIdsCapacity = 0;
+    int* restaurantNodeIds = nullptr;   // Vértice de cada restaurante en el grafo
+    int restaurantNodeIdsCapacity = 0;
+    int* nodeCatalogIds = nullptr;      // Índice de catálogo de cada vértice; el grafo interna los nombres
+    int nodeCatalogIdsCapacity = 0;
+    void linkCatalogNode(int*& catalogNodeIds, int& catalogNodeIdsCapacity, int index, int node);
+    int catalogIndexOfNode(int node) const;
+    static const int SIMILAR_DISHES_K = 10;  // Similares que se guardan por platillo
+    IndiceSimilitud dishSimilarityIndex;
+    IndiceMinHash restaurantMenuIndex;
+    MatrizMenus restaurantMenuMatrix;   // Menús como bits, para comparar todos los pares exactos
+    PageRankPersonalizado recommender;
+    LineaTiempoGrafo graphTimeline;     // Pedidos por día de cada arista, para consultas por fechas
+    mutable Centralidad graphCentrality;  // Se calcula en la primera consulta (un BFS por nodo)
+    mutable CaminosPonderados pathFinder; // Buffers de Dijkstra reutilizados entre consultas
+    bool parseDayRange(const String& startDate, const String& endDate, int& startDay, int& endDay) const;
+    int findRestaurantNode(const String& name) const;
     int partition(Order* arr, int low, int high);
     void quickSort(Order* arr, int low, int high);
     int dishesCount = 0;
     
+    OrderManager(const OrderManager&);
+    OrderManager& operator=(const OrderManager&);
 
 };
 
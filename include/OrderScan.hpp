@@ -0,0 +1,62 @@
+#ifndef ORDERSCAN_HPP
+#define ORDERSCAN_HPP
+#include "OrderColumns.hpp"
+
+/*
+    struct: OrderPredicate
+    Descripcion: Filtro compuesto sobre las órdenes; una fila se selecciona si cumple todas
+                 las condiciones.
+    Campos:
+        - fromTimestamp / toTimestamp: Rango de fechas numéricas (inclusivo).
+        - minPrice / maxPrice: Rango de precios (inclusivo).
+        - restaurantSet: Arreglo indexado por índice de restaurante, distinto de 0 si el
+                         restaurante está en el conjunto. nullptr acepta todos.
+        - restaurantSetSize: Tamaño de restaurantSet; los índices fuera de él no pasan.
+*/
+struct OrderPredicate {
+    long long fromTimestamp;
+    long long toTimestamp;
+    int minPrice;
+    int maxPrice;
+    const unsigned char* restaurantSet;
+    int restaurantSetSize;
+};
+
+/*
+    class: OrderScan
+    Descripcion: Evalúa un OrderPredicate sobre OrderColumns y deja el resultado en un
+                 bitmap de selección (un bit por fila), del que salen la lista de índices
+                 y los agregados.
+                 Como la columna de fechas está ordenada, el rango de fechas se resuelve con
+                 dos búsquedas binarias; precio y restaurante se evalúan sólo en esas filas
+                 con un kernel AVX2 (8 filas por instrucción, el conjunto de restaurantes se
+                 consulta con un gather) si el procesador lo soporta, o con uno escalar sin
+                 saltos si no. El bitmap y la tabla del conjunto se reutilizan entre consultas.
+*/
+class OrderScan {
+public:
+    OrderScan();
+    ~OrderScan();
+
+    int run(const OrderColumns& columns, const OrderPredicate& predicate);
+    int selectedCount() const;
+    bool isSelected(int row) const;
+    int toIndices(int* indices, int capacity) const;
+    OrderAggregate aggregate(const OrderColumns& columns) const;
+
+private:
+    unsigned long long* bitmap;  // Bit i = fila i seleccionada
+    int bitmapWords;
+    int* restaurantTable;        // restaurantSet expandido a int (-1 / 0) para el gather
+    int restaurantTableSize;
+    int firstRow;                // Filas dentro del rango de fechas: [firstRow, lastRow)
+    int lastRow;
+    int selected;
+
+    OrderScan(const OrderScan&);
+    OrderScan& operator=(const OrderScan&);
+
+    void prepare(int rows, const OrderPredicate& predicate);
+};
+
+#endif
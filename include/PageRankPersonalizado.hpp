@@ -0,0 +1,42 @@
+#ifndef PAGERANKPERSONALIZADO_HPP
+#define PAGERANKPERSONALIZADO_HPP
+
+#include "Graph.hpp"
+
+/*
+    struct: Recomendacion
+    Descripcion: Un nodo recomendado y su puntaje de PageRank personalizado.
+*/
+struct Recomendacion {
+    int nodo;
+    double puntaje;
+};
+
+/*
+    class: PageRankPersonalizado
+    Descripcion: PageRank personalizado (caminata aleatoria con reinicio) sobre el grafo
+                 Platillo-Restaurante. En cada paso el caminante sigue una arista con
+                 probabilidad proporcional a su peso (pedidos) o, con probabilidad 1 - alfa,
+                 regresa al nodo de origen. El puntaje de cada nodo es la probabilidad de
+                 estar en él a largo plazo: los nodos "cercanos" al origen por muchos caminos
+                 muy pedidos obtienen los puntajes más altos.
+                 Se calcula con iteración de potencia en modo "pull" sobre el CSR del grafo:
+                 cada hilo calcula el nuevo puntaje de un rango de nodos leyendo a sus vecinos,
+                 así que no hay escrituras compartidas. Se detiene cuando el cambio total (L1)
+                 baja de la tolerancia.
+*/
+class PageRankPersonalizado {
+public:
+    PageRankPersonalizado(double alfa = 0.85, double tolerancia = 1e-6, int maxIteraciones = 100);
+
+    int calcular(const Graph& grafo, int nodoOrigen, double* puntajes, int numHilos = 0) const;
+    int recomendar(const Graph& grafo, int nodoOrigen, char tipo, Recomendacion* resultado, int capacidad) const;
+    void imprimirRecomendaciones(const Graph& grafo, int nodoOrigen, char tipo, int n) const;
+
+private:
+    double alfa;              // Probabilidad de seguir una arista (1 - alfa = reiniciar)
+    double tolerancia;        // Cambio L1 máximo para considerar que convergió
+    int maxIteraciones;
+};
+
+#endif // PAGERANKPERSONALIZADO_HPP
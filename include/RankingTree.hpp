@@ -0,0 +1,135 @@
+#ifndef RANKINGTREE_HPP
+#define RANKINGTREE_HPP
+
+#include "Arena.hpp"
+
+/*
+    struct: AscendingOrder
+    Descripcion: Comparador por defecto del RankingTree: orden natural ascendente de la llave.
+                 Se resuelve en tiempo de compilación (sin funciones virtuales).
+*/
+template <typename Key>
+struct AscendingOrder {
+    static bool less(const Key& a, const Key& b) { return a < b; }
+};
+
+/*
+    Clase: RankingNode
+    Descripcion: Nodo de un árbol binario de búsqueda que agrupa elementos con la misma llave.
+                 El nodo no copia los elementos: guarda sólo su ID (índice en el catálogo).
+                 Los nodos y sus arrays viven en la arena del RankingTree que los creó.
+*/
+template <typename Key>
+class RankingNode {
+public:
+    Key key;                  // Llave del nodo (ej. número de pedidos)
+    int* itemIds;             // Array dinámico con los IDs de los elementos con la misma llave
+    int itemCapacity;         // Capacidad del array
+    int itemCount;            // Cantidad actual de elementos en el array
+    int height;               // Altura del subárbol que inicia en este nodo
+    int subtreeItems;         // Total de elementos en el subárbol (para consultas de rango y percentil)
+    RankingNode* left;
+    RankingNode* right;
+
+    explicit RankingNode(const Key& nodeKey);
+    int addItem(int itemId, Arena& arena);
+    int removeItemAt(int slot);
+    void resize(Arena& arena);
+};
+
+/*
+    struct: RankingBucketView
+    Descripcion: Vista de sólo lectura sobre una cubeta del árbol. Los IDs apuntan
+                 directamente al array del nodo, por lo que no hay que liberar nada,
+                 pero la vista deja de ser válida si el árbol se modifica.
+*/
+template <typename Key>
+struct RankingBucketView {
+    Key key;
+    const int* itemIds;
+    int itemCount;
+};
+
+/*
+    Clase: RankingTree
+    Descripcion: Árbol AVL de cubetas para rankings (leaderboards). Trabaja sobre un catálogo
+                 externo (arreglo de Item) y sólo guarda los IDs de sus elementos.
+    Parametros de la plantilla:
+        - Item: Tipo de los elementos del catálogo; debe tener getName().
+        - Key: Tipo de la llave por la que se ordena (int, long long, ...).
+        - KeyOf: Clase con static Key keyOf(const Item&) y las etiquetas keyLabel() e
+                 itemsLabel() que se usan al imprimir.
+        - Compare: Comparador con static bool less(const Key&, const Key&).
+    Las definiciones están en RankingTreeImpl.hpp. Cada módulo instancia explícitamente
+    sus propios rankings (los de pedidos en src/RankingTree.cpp, los de centralidad en
+    src/Centralidad.cpp).
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare = AscendingOrder<Key> >
+class RankingTree {
+public:
+    RankingTree();
+    ~RankingTree();
+
+    void setCatalog(const Item* source);
+    void insert(int itemId);
+    void buildFromItems(const Item* source, int count);
+    void clear();
+    void updateItem(int itemId);
+    void removeItem(int itemId);
+    bool containsItem(int itemId) const;
+    RankingBucketView<Key> findTop() const;
+    void printInOrder() const;
+    void printInReverseOrder() const;
+    Key getMaxKey() const;
+    int getTopN(int n, int* resultIds, int capacity) const;
+    int getTotalItems() const;
+    int getRank(int itemId) const;
+    int countInRange(const Key& minKey, const Key& maxKey) const;
+    RankingBucketView<Key> selectByPosition(int position) const;
+    RankingBucketView<Key> getPercentile(double percentile) const;
+    void showStatistics() const;
+    void printNodes() const;
+
+private:
+    RankingNode<Key>* root;
+    const Item* catalog;      // Catálogo de elementos al que se refieren los IDs
+    RankingNode<Key>** nodeOfItem;  // Handle: nodo (cubeta) donde vive cada elemento, por ID
+    int* slotOfItem;          // Posición del elemento dentro del array de su cubeta
+    int handleCapacity;
+    Arena nodeArena;          // Memoria de todos los nodos y sus arrays de IDs
+    RankingNode<Key>* freeNodes;  // Nodos eliminados listos para reutilizarse (enlazados por 'left')
+
+    RankingTree(const RankingTree&);
+    RankingTree& operator=(const RankingTree&);
+
+    static bool equalKeys(const Key& a, const Key& b);
+    void sortByKey(int* order, int count) const;
+    RankingNode<Key>* insertNode(RankingNode<Key>* node, int itemId, const Key& key);
+    RankingNode<Key>* buildBalanced(RankingNode<Key>** nodes, int low, int high);
+    RankingNode<Key>* createNode(const Key& key, int capacity);
+    void recycleNode(RankingNode<Key>* node);
+    void trackItem(int itemId, RankingNode<Key>* node, int slot);
+    void ensureHandleCapacity(int itemId);
+    void clearHandles();
+    RankingNode<Key>* insertBucket(RankingNode<Key>* node, const Key& key, RankingNode<Key>*& bucket);
+    RankingNode<Key>* removeBucket(RankingNode<Key>* node, const Key& key);
+    RankingNode<Key>* detachMin(RankingNode<Key>* node, RankingNode<Key>*& minNode);
+    void updateMetrics(RankingNode<Key>* node);
+    void adjustPathCount(const Key& key, int delta);
+    int countBelow(const Key& key, bool inclusive) const;
+    int getSubtreeItems(RankingNode<Key>* node) const;
+    void balanceWholeTree(RankingNode<Key>*& node);
+    void balanceSubtree(RankingNode<Key>*& node);
+    void rotateLeft(RankingNode<Key>*& node);
+    void rotateRight(RankingNode<Key>*& node);
+    void printInOrderHelper(RankingNode<Key>* node) const;
+    void printInReverseOrderHelper(RankingNode<Key>* node) const;
+    void printBucketNames(RankingNode<Key>* node) const;
+    int getHeight(RankingNode<Key>* node) const;
+    Key findMaxKey(RankingNode<Key>* node) const;
+    int getBalanceFactor(RankingNode<Key>* node) const;
+    void collectTopN(RankingNode<Key>* node, int& remaining, int* resultIds, int capacity, int& resultCount) const;
+    void printNodeHelper(RankingNode<Key>* node) const;
+};
+
+#endif // RANKINGTREE_HPP
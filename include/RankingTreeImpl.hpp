@@ -0,0 +1,1137 @@
+#ifndef RANKINGTREEIMPL_HPP
+#define RANKINGTREEIMPL_HPP
+
+// Definiciones de RankingTree. Sólo las incluye el .cpp que instancia el árbol para
+// sus tipos; el resto del sistema usa únicamente RankingTree.hpp.
+#include "RankingTree.hpp"
+#include <iostream>
+#include <cmath>
+#include <type_traits>
+
+/*
+    funcion: RankingNode (Constructor)
+    Descripcion: Inicializa un nodo vacío del árbol para una llave. El array de IDs
+                 lo asigna el RankingTree desde su arena (ver RankingTree::createNode).
+    Parametros:
+        - nodeKey (const Key&): Llave del nodo (ej. número de pedidos).
+    Return: N/A
+    Complejidad: O(1)
+*/
+template <typename Key>
+RankingNode<Key>::RankingNode(const Key& nodeKey)
+    : key(nodeKey), itemIds(nullptr), itemCapacity(0), itemCount(0), height(1), subtreeItems(0), left(nullptr), right(nullptr) {
+}
+
+/*
+    funcion: addItem
+    Descripcion: Agrega el ID de un elemento al array del nodo.
+                 Si el array está lleno, lo redimensiona dentro de la arena.
+    Parametros:
+        - itemId (int): ID del elemento en el catálogo.
+        - arena (Arena&): Arena del árbol al que pertenece el nodo.
+    Return: (int) Posición donde quedó el elemento dentro del array.
+    Complejidad: O(1) amortizado, O(n) en el peor caso cuando se redimensiona.
+*/
+template <typename Key>
+int RankingNode<Key>::addItem(int itemId, Arena& arena) {
+    if (itemCount >= itemCapacity) {
+        resize(arena);
+    }
+    itemIds[itemCount] = itemId;
+    return itemCount++;
+}
+
+/*
+    funcion: removeItemAt
+    Descripcion: Quita el elemento de la posición indicada moviendo el último elemento
+                 del array a su lugar, para no tener que recorrer el resto del array.
+    Parametros:
+        - slot (int): Posición del elemento a quitar.
+    Return: (int) ID del elemento que se movió a la posición 'slot', o -1 si no se movió ninguno.
+    Complejidad: O(1)
+*/
+template <typename Key>
+int RankingNode<Key>::removeItemAt(int slot) {
+    if (slot < 0 || slot >= itemCount) return -1;
+    const int last = --itemCount;
+    if (slot == last) return -1;
+    itemIds[slot] = itemIds[last];
+    return itemIds[slot];
+}
+
+/*
+    funcion: resize
+    Descripcion: Duplica la capacidad del array de IDs cuando está lleno. El array anterior
+                 se queda en la arena hasta la siguiente reconstrucción; como la capacidad
+                 se duplica, lo desperdiciado nunca supera el tamaño del array actual.
+    Parametros:
+        - arena (Arena&): Arena del árbol al que pertenece el nodo.
+    Return: N/A
+    Complejidad: O(n), donde n es la cantidad actual de elementos en el nodo.
+*/
+template <typename Key>
+void RankingNode<Key>::resize(Arena& arena) {
+    itemCapacity = itemCapacity > 0 ? itemCapacity * 2 : 4;
+    int* newIds = arena.allocateArray<int>(itemCapacity);
+    for (int i = 0; i < itemCount; ++i) {
+        newIds[i] = itemIds[i];
+    }
+    itemIds = newIds;
+}
+
+/*
+    funcion: RankingTree (Constructor)
+    Descripcion: Inicializa un árbol binario de búsqueda vacío.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(1)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+RankingTree<Item, Key, KeyOf, Compare>::RankingTree() : root(nullptr), catalog(nullptr), nodeOfItem(nullptr), slotOfItem(nullptr), handleCapacity(0), freeNodes(nullptr) {}
+
+/*
+    funcion: ~RankingTree (Destructor)
+    Descripcion: Libera el mapa de handles. Los nodos se liberan junto con la arena.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(b), donde b es el número de bloques de la arena.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+RankingTree<Item, Key, KeyOf, Compare>::~RankingTree() {
+    delete[] nodeOfItem;
+    delete[] slotOfItem;
+}
+
+/*
+    funcion: createNode
+    Descripcion: Obtiene un nodo para la llave indicada, reutilizando uno de la lista de
+                 nodos libres si hay, o creándolo en la arena. El array de IDs se reserva
+                 con al menos la capacidad pedida.
+    Parametros:
+        - key (const Key&): Llave del nodo.
+        - capacity (int): Capacidad mínima del array de IDs.
+    Return: (RankingNode<Key>*) Nodo vacío listo para enlazarse.
+    Complejidad: O(1)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+RankingNode<Key>* RankingTree<Item, Key, KeyOf, Compare>::createNode(const Key& key, int capacity) {
+    RankingNode<Key>* node = freeNodes;
+    if (node != nullptr) {
+        freeNodes = node->left;
+        int* ids = node->itemIds;
+        const int idsCapacity = node->itemCapacity;
+        *node = RankingNode<Key>(key);
+        node->itemIds = ids;
+        node->itemCapacity = idsCapacity;
+    } else {
+        node = nodeArena.template create<RankingNode<Key>>(key);
+    }
+    if (node->itemCapacity < capacity) {
+        node->itemIds = nodeArena.template allocateArray<int>(capacity);
+        node->itemCapacity = capacity;
+    }
+    return node;
+}
+
+/*
+    funcion: recycleNode
+    Descripcion: Regresa un nodo eliminado del árbol a la lista de nodos libres,
+                 conservando su array de IDs para el siguiente uso.
+    Parametros:
+        - node (RankingNode<Key>*): Nodo ya desenlazado del árbol.
+    Return: N/A
+    Complejidad: O(1)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::recycleNode(RankingNode<Key>* node) {
+    node->right = nullptr;
+    node->left = freeNodes;
+    freeNodes = node;
+}
+
+/*
+    funcion: setCatalog
+    Descripcion: Indica el catálogo de elementos al que se refieren los IDs del árbol.
+                 El catálogo debe seguir vivo mientras se use el árbol.
+    Parametros:
+        - source (const Item*): Arreglo de elementos.
+    Return: N/A
+    Complejidad: O(1)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::setCatalog(const Item* source) {
+    catalog = source;
+}
+
+/*
+    funcion: insert
+    Descripcion: Inserta un elemento del catálogo en el BST. Si ya existe un nodo con la misma
+                 llave, agrega el elemento a ese nodo. El árbol se rebalancea
+                 sobre el camino de inserción.
+    Parametros:
+        - itemId (int): ID del elemento en el catálogo.
+    Return: N/A
+    Complejidad: O(h + k), donde h es la altura del árbol y k es el número de elementos
+                 en el nodo (si se necesita redimensionar el array).
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::insert(int itemId) {
+    if (catalog == nullptr || itemId < 0) return;
+    root = insertNode(root, itemId, KeyOf::keyOf(catalog[itemId]));
+}
+
+/*
+    funcion: clear
+    Descripcion: Deja el árbol vacío. Todos los nodos se descartan de una vez
+                 reiniciando la arena, sin recorrer el árbol.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(1) para los nodos, más O(c) para limpiar el mapa de handles.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::clear() {
+    root = nullptr;
+    freeNodes = nullptr;
+    nodeArena.reset();
+    clearHandles();
+}
+
+/*
+    funcion: buildFromItems
+    Descripcion: Reconstruye el árbol completo a partir de un arreglo de elementos, que
+                 pasa a ser el catálogo del árbol.
+                 Ordena los elementos por llave, agrupa las llaves iguales en una sola
+                 cubeta (RankingNode) y arma un árbol perfectamente balanceado tomando
+                 siempre la cubeta de en medio como raíz. El orden de los elementos dentro
+                 de cada cubeta es el mismo del arreglo original, igual que con
+                 inserciones sucesivas.
+    Parametros:
+        - source (const Item*): Arreglo de elementos a cargar.
+        - count (int): Cantidad de elementos en el arreglo.
+    Return: N/A
+    Complejidad: O(n + c) con llaves enteras de rango c (counting sort), O(n log n) en otro caso.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::buildFromItems(const Item* source, int count) {
+    clear();
+    catalog = source;
+    if (source == nullptr || count <= 0) return;
+
+    int* order = new int[count];
+    sortByKey(order, count);
+
+    // Un nodo por cada llave distinta, ya en orden ascendente
+    RankingNode<Key>** sortedNodes = new RankingNode<Key>*[count];
+    int nodeCount = 0;
+    int first = 0;
+    while (first < count) {
+        const Key key = KeyOf::keyOf(source[order[first]]);
+        int last = first + 1;
+        while (last < count && equalKeys(KeyOf::keyOf(source[order[last]]), key)) last++;
+
+        RankingNode<Key>* node = createNode(key, last - first);
+        for (int i = first; i < last; ++i) {
+            trackItem(order[i], node, node->addItem(order[i], nodeArena));
+        }
+        sortedNodes[nodeCount++] = node;
+        first = last;
+    }
+
+    root = buildBalanced(sortedNodes, 0, nodeCount - 1);
+
+    delete[] order;
+    delete[] sortedNodes;
+}
+
+/*
+    funcion: sortByKey
+    Descripcion: Llena 'order' con los IDs del catálogo ordenados ascendentemente por llave,
+                 de forma estable. Con llaves enteras en orden natural y un rango pequeño
+                 usa counting sort; en otro caso usa merge sort de abajo hacia arriba.
+    Parametros:
+        - order (int*): Arreglo de salida con espacio para 'count' IDs.
+        - count (int): Cantidad de elementos del catálogo.
+    Return: N/A
+    Complejidad: O(n + c) con counting sort, O(n log n) con merge sort.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::sortByKey(int* order, int count) const {
+    if constexpr (std::is_integral<Key>::value && std::is_same<Compare, AscendingOrder<Key>>::value) {
+        Key minKey = KeyOf::keyOf(catalog[0]);
+        Key maxKey = minKey;
+        for (int i = 1; i < count; ++i) {
+            const Key key = KeyOf::keyOf(catalog[i]);
+            if (key < minKey) minKey = key;
+            if (key > maxKey) maxKey = key;
+        }
+        const long long range = static_cast<long long>(maxKey) - static_cast<long long>(minKey) + 1;
+        if (range <= 4LL * count + 1024) {
+            // Counting sort: posición inicial de cada llave
+            int* starts = new int[range + 1];
+            for (long long k = 0; k <= range; ++k) starts[k] = 0;
+            for (int i = 0; i < count; ++i) starts[KeyOf::keyOf(catalog[i]) - minKey + 1]++;
+            for (long long k = 1; k <= range; ++k) starts[k] += starts[k - 1];
+            for (int i = 0; i < count; ++i) order[starts[KeyOf::keyOf(catalog[i]) - minKey]++] = i;
+            delete[] starts;
+            return;
+        }
+    }
+
+    int* buffer = new int[count];
+    for (int i = 0; i < count; ++i) order[i] = i;
+    for (int width = 1; width < count; width *= 2) {
+        for (int low = 0; low < count; low += 2 * width) {
+            const int mid = low + width < count ? low + width : count;
+            const int high = low + 2 * width < count ? low + 2 * width : count;
+            int left = low, right = mid, out = low;
+            while (left < mid && right < high) {
+                // Tomar de la derecha sólo si es estrictamente menor para conservar la estabilidad
+                if (Compare::less(KeyOf::keyOf(catalog[order[right]]), KeyOf::keyOf(catalog[order[left]]))) {
+                    buffer[out++] = order[right++];
+                } else {
+                    buffer[out++] = order[left++];
+                }
+            }
+            while (left < mid) buffer[out++] = order[left++];
+            while (right < high) buffer[out++] = order[right++];
+        }
+        for (int i = 0; i < count; ++i) order[i] = buffer[i];
+    }
+    delete[] buffer;
+}
+
+/*
+    funcion: equalKeys
+    Descripcion: Indica si dos llaves son equivalentes según el comparador del árbol.
+    Parametros:
+        - a (const Key&): Primera llave.
+        - b (const Key&): Segunda llave.
+    Return: (bool) true si ninguna es menor que la otra.
+    Complejidad: O(1)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+bool RankingTree<Item, Key, KeyOf, Compare>::equalKeys(const Key& a, const Key& b) {
+    return !Compare::less(a, b) && !Compare::less(b, a);
+}
+
+/*
+    funcion: buildBalanced
+    Descripcion: Función auxiliar recursiva que enlaza un arreglo de nodos ordenado
+                 en un árbol perfectamente balanceado.
+    Parametros:
+        - nodes (RankingNode<Key>**): Nodos ordenados ascendentemente por llave.
+        - low (int): Índice inicial del rango.
+        - high (int): Índice final del rango.
+    Return: (RankingNode<Key>*) Raíz del subárbol construido.
+    Complejidad: O(m), donde m es la cantidad de nodos en el rango.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+RankingNode<Key>* RankingTree<Item, Key, KeyOf, Compare>::buildBalanced(RankingNode<Key>** nodes, int low, int high) {
+    if (low > high) return nullptr;
+    const int mid = low + (high - low) / 2;
+    RankingNode<Key>* node = nodes[mid];
+    node->left = buildBalanced(nodes, low, mid - 1);
+    node->right = buildBalanced(nodes, mid + 1, high);
+    updateMetrics(node);
+    return node;
+}
+
+/*
+    funcion: insertNode
+    Descripcion: Función auxiliar recursiva para insertar un elemento en el BST.
+    Parametros:
+        - node (RankingNode<Key>*): Raíz del subárbol actual.
+        - itemId (int): ID del elemento en el catálogo.
+        - key (const Key&): Llave del elemento.
+    Return: (RankingNode<Key>*) Raíz del subárbol modificado.
+    Complejidad: O(h + k), donde h es la altura del subárbol y k es el número de elementos
+                 en el nodo si se necesita redimensionar.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+RankingNode<Key>* RankingTree<Item, Key, KeyOf, Compare>::insertNode(RankingNode<Key>* node, int itemId, const Key& key) {
+    if (node == nullptr) {
+        RankingNode<Key>* created = createNode(key, 4);
+        trackItem(itemId, created, created->addItem(itemId, nodeArena));
+        updateMetrics(created);
+        return created;
+    }
+    
+    if (equalKeys(key, node->key)) {
+        // El nodo ya existe con esta llave, agregar el elemento al array
+        trackItem(itemId, node, node->addItem(itemId, nodeArena));
+        updateMetrics(node);
+        return node;
+    } else if (Compare::less(key, node->key)) {
+        node->left = insertNode(node->left, itemId, key);
+    } else {
+        node->right = insertNode(node->right, itemId, key);
+    }
+    balanceSubtree(node);
+    return node;
+}
+
+/*
+    funcion: updateItem
+    Descripcion: Mantiene el ranking al día cuando cambia la llave de un elemento.
+                 Usa el mapa de handles para encontrar la cubeta actual del elemento, lo saca
+                 de ella y lo agrega a la cubeta de su nuevo conteo (normalmente count+1 al
+                 registrar un pedido o count-1 al cancelarlo). Las cubetas vacías se eliminan
+                 y las nuevas se crean, rebalanceando sólo el camino afectado. Si el elemento
+                 no estaba en el árbol se inserta. Igual que insert y buildFromItems, un
+                 elemento con llave 0 (0 pedidos, 0 ingresos) se queda en el árbol, así que
+                 getRank y getTotalItems no dependen de cómo llegó a 0.
+    Parametros:
+        - itemId (int): ID del elemento en el catálogo, cuyo conteo ya fue actualizado.
+    Return: N/A
+    Complejidad: O(log n), donde n es el número de nodos en el árbol.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::updateItem(int itemId) {
+    if (catalog == nullptr || itemId < 0) return;
+    const Key newKey = KeyOf::keyOf(catalog[itemId]);
+
+    if (containsItem(itemId)) {
+        if (equalKeys(nodeOfItem[itemId]->key, newKey)) return;
+        removeItem(itemId);
+    }
+
+    RankingNode<Key>* bucket = nullptr;
+    root = insertBucket(root, newKey, bucket);
+    trackItem(itemId, bucket, bucket->addItem(itemId, nodeArena));
+    adjustPathCount(newKey, 1);
+}
+
+/*
+    funcion: removeItem
+    Descripcion: Quita un elemento del árbol usando su handle. Si su cubeta queda vacía,
+                 el nodo se elimina del árbol.
+    Parametros:
+        - itemId (int): ID del elemento en el catálogo.
+    Return: N/A
+    Complejidad: O(log n), donde n es el número de nodos en el árbol.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::removeItem(int itemId) {
+    if (!containsItem(itemId)) return;
+    RankingNode<Key>* current = nodeOfItem[itemId];
+    const int slot = slotOfItem[itemId];
+
+    const int movedId = current->removeItemAt(slot);
+    if (movedId >= 0) slotOfItem[movedId] = slot;
+    nodeOfItem[itemId] = nullptr;
+    adjustPathCount(current->key, -1);
+
+    if (current->itemCount == 0) {
+        root = removeBucket(root, current->key);
+    }
+}
+
+/*
+    funcion: containsItem
+    Descripcion: Indica si el elemento con el ID dado está actualmente en el árbol.
+    Parametros:
+        - itemId (int): ID del elemento en el catálogo.
+    Return: (bool) true si el elemento tiene handle en el árbol.
+    Complejidad: O(1)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+bool RankingTree<Item, Key, KeyOf, Compare>::containsItem(int itemId) const {
+    return itemId >= 0 && itemId < handleCapacity && nodeOfItem[itemId] != nullptr;
+}
+
+/*
+    funcion: trackItem
+    Descripcion: Registra en el mapa de handles el nodo y la posición de un elemento.
+    Parametros:
+        - itemId (int): ID del elemento en el catálogo.
+        - node (RankingNode<Key>*): Cubeta donde vive el elemento.
+        - slot (int): Posición dentro del array de la cubeta.
+    Return: N/A
+    Complejidad: O(1) amortizado.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::trackItem(int itemId, RankingNode<Key>* node, int slot) {
+    if (itemId < 0) return;
+    ensureHandleCapacity(itemId);
+    nodeOfItem[itemId] = node;
+    slotOfItem[itemId] = slot;
+}
+
+/*
+    funcion: ensureHandleCapacity
+    Descripcion: Hace crecer (al doble) el mapa de handles hasta que el ID indicado quepa.
+    Parametros:
+        - itemId (int): ID que debe poder almacenarse.
+    Return: N/A
+    Complejidad: O(n) cuando crece, O(1) en otro caso.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::ensureHandleCapacity(int itemId) {
+    if (itemId < handleCapacity) return;
+    int newCapacity = handleCapacity > 0 ? handleCapacity : 16;
+    while (newCapacity <= itemId) newCapacity *= 2;
+
+    RankingNode<Key>** newNodes = new RankingNode<Key>*[newCapacity];
+    int* newSlots = new int[newCapacity];
+    for (int i = 0; i < newCapacity; ++i) {
+        newNodes[i] = i < handleCapacity ? nodeOfItem[i] : nullptr;
+        newSlots[i] = i < handleCapacity ? slotOfItem[i] : -1;
+    }
+    delete[] nodeOfItem;
+    delete[] slotOfItem;
+    nodeOfItem = newNodes;
+    slotOfItem = newSlots;
+    handleCapacity = newCapacity;
+}
+
+/*
+    funcion: clearHandles
+    Descripcion: Marca todos los elementos como fuera del árbol.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(c), donde c es la capacidad del mapa de handles.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::clearHandles() {
+    for (int i = 0; i < handleCapacity; ++i) {
+        nodeOfItem[i] = nullptr;
+        slotOfItem[i] = -1;
+    }
+}
+
+/*
+    funcion: insertBucket
+    Descripcion: Busca la cubeta con el conteo indicado y la crea vacía si no existe,
+                 rebalanceando (AVL) el camino de inserción.
+    Parametros:
+        - node (RankingNode<Key>*): Raíz del subárbol actual.
+        - key (const Key&): Llave de la cubeta.
+        - bucket (RankingNode<Key>*&): Recibe la cubeta encontrada o creada.
+    Return: (RankingNode<Key>*) Raíz del subárbol modificado.
+    Complejidad: O(log n)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+RankingNode<Key>* RankingTree<Item, Key, KeyOf, Compare>::insertBucket(RankingNode<Key>* node, const Key& key, RankingNode<Key>*& bucket) {
+    if (node == nullptr) {
+        bucket = createNode(key, 4);
+        return bucket;
+    }
+    if (equalKeys(key, node->key)) {
+        bucket = node;
+        return node;
+    }
+    if (Compare::less(key, node->key)) {
+        node->left = insertBucket(node->left, key, bucket);
+    } else {
+        node->right = insertBucket(node->right, key, bucket);
+    }
+    balanceSubtree(node);
+    return node;
+}
+
+/*
+    funcion: removeBucket
+    Descripcion: Elimina del árbol la cubeta con el conteo indicado (AVL). Cuando el nodo
+                 tiene dos hijos se reemplaza por su sucesor re-enlazando el nodo sucesor
+                 en lugar de copiar sus datos, para que los handles sigan siendo válidos.
+    Parametros:
+        - node (RankingNode<Key>*): Raíz del subárbol actual.
+        - key (const Key&): Llave de la cubeta a eliminar.
+    Return: (RankingNode<Key>*) Raíz del subárbol modificado.
+    Complejidad: O(log n)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+RankingNode<Key>* RankingTree<Item, Key, KeyOf, Compare>::removeBucket(RankingNode<Key>* node, const Key& key) {
+    if (node == nullptr) return nullptr;
+
+    if (Compare::less(key, node->key)) {
+        node->left = removeBucket(node->left, key);
+    } else if (Compare::less(node->key, key)) {
+        node->right = removeBucket(node->right, key);
+    } else {
+        RankingNode<Key>* leftChild = node->left;
+        RankingNode<Key>* rightChild = node->right;
+        recycleNode(node);
+
+        if (leftChild == nullptr) return rightChild;
+        if (rightChild == nullptr) return leftChild;
+
+        RankingNode<Key>* successor = nullptr;
+        rightChild = detachMin(rightChild, successor);
+        successor->left = leftChild;
+        successor->right = rightChild;
+        node = successor;
+    }
+    balanceSubtree(node);
+    return node;
+}
+
+/*
+    funcion: detachMin
+    Descripcion: Desprende el nodo con el menor conteo del subárbol y rebalancea el camino.
+    Parametros:
+        - node (RankingNode<Key>*): Raíz del subárbol (no nula).
+        - minNode (RankingNode<Key>*&): Recibe el nodo desprendido.
+    Return: (RankingNode<Key>*) Raíz del subárbol sin el nodo mínimo.
+    Complejidad: O(log n)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+RankingNode<Key>* RankingTree<Item, Key, KeyOf, Compare>::detachMin(RankingNode<Key>* node, RankingNode<Key>*& minNode) {
+    if (node->left == nullptr) {
+        minNode = node;
+        RankingNode<Key>* rightChild = node->right;
+        node->right = nullptr;
+        return rightChild;
+    }
+    node->left = detachMin(node->left, minNode);
+    balanceSubtree(node);
+    return node;
+}
+
+/*
+    funcion: updateMetrics
+    Descripcion: Recalcula la altura y el total de elementos del subárbol de un nodo
+                 a partir de los valores de sus hijos.
+    Parametros:
+        - node (RankingNode<Key>*): Nodo a actualizar.
+    Return: N/A
+    Complejidad: O(1)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::updateMetrics(RankingNode<Key>* node) {
+    if (node == nullptr) return;
+    const int leftHeight = getHeight(node->left);
+    const int rightHeight = getHeight(node->right);
+    node->height = 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+    node->subtreeItems = getSubtreeItems(node->left) + node->itemCount + getSubtreeItems(node->right);
+}
+
+/*
+    funcion: adjustPathCount
+    Descripcion: Suma 'delta' al total de elementos de cada nodo en el camino desde la raíz
+                 hasta la cubeta con el conteo indicado. Se usa cuando cambia el número de
+                 elementos de una cubeta sin cambiar la forma del árbol.
+    Parametros:
+        - key (const Key&): Llave de la cubeta modificada.
+        - delta (int): Cantidad de elementos agregados (positiva) o quitados (negativa).
+    Return: N/A
+    Complejidad: O(h), donde h es la altura del árbol.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::adjustPathCount(const Key& key, int delta) {
+    RankingNode<Key>* node = root;
+    while (node != nullptr) {
+        node->subtreeItems += delta;
+        if (equalKeys(key, node->key)) return;
+        node = Compare::less(key, node->key) ? node->left : node->right;
+    }
+}
+
+/*
+    funcion: getSubtreeItems
+    Descripcion: Obtiene el total de elementos del subárbol, 0 si el nodo es nulo.
+    Parametros:
+        - node (RankingNode<Key>*): Raíz del subárbol.
+    Return: (int) Total de elementos en el subárbol.
+    Complejidad: O(1)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+int RankingTree<Item, Key, KeyOf, Compare>::getSubtreeItems(RankingNode<Key>* node) const {
+    return node == nullptr ? 0 : node->subtreeItems;
+}
+
+/*
+    funcion: getMaxKey
+    Descripcion: Encuentra la llave máxima (ej. el número máximo de pedidos) en el árbol.
+    Parametros: Ninguno
+    Return: (Key) La llave máxima, o Key() (0) si el árbol está vacío.
+    Complejidad: O(h), donde h es la altura del árbol.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+Key RankingTree<Item, Key, KeyOf, Compare>::getMaxKey() const {
+    return findMaxKey(root);
+}
+
+/*
+    funcion: findMaxKey
+    Descripcion: Función auxiliar recursiva para encontrar la llave máxima.
+                 En un BST, el valor máximo está en el nodo más a la derecha.
+    Parametros:
+        - node (RankingNode<Key>*): Raíz del subárbol actual.
+    Return: (Key) La llave máxima del subárbol.
+    Complejidad: O(h), donde h es la altura del subárbol.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+Key RankingTree<Item, Key, KeyOf, Compare>::findMaxKey(RankingNode<Key>* node) const {
+    if (node == nullptr) return Key();
+    if (node->right == nullptr) return node->key;
+    return findMaxKey(node->right);
+}
+
+/*
+    funcion: findTop
+    Descripcion: Encuentra todos los elementos con la mayor llave.
+                 Maneja el caso de múltiples elementos con la misma llave máxima.
+                 Como todos ellos viven en la cubeta más a la derecha, se devuelve una vista
+                 sobre esa cubeta sin copiar ni reservar memoria.
+    Parametros: Ninguno
+    Return: (RankingBucketView<Key>) Vista con el conteo máximo y los IDs de los elementos;
+            itemCount = 0 si el árbol está vacío.
+    Complejidad: O(h), donde h es la altura del árbol.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+RankingBucketView<Key> RankingTree<Item, Key, KeyOf, Compare>::findTop() const {
+    RankingBucketView<Key> view = {Key(), nullptr, 0};
+    RankingNode<Key>* node = root;
+    while (node != nullptr && node->right != nullptr) {
+        node = node->right;
+    }
+    if (node != nullptr) {
+        view.key = node->key;
+        view.itemIds = node->itemIds;
+        view.itemCount = node->itemCount;
+    }
+    return view;
+}
+
+/*
+    funcion: printInOrder
+    Descripcion: Imprime todos los elementos del árbol en orden ascendente por llave.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(n * m), donde n es el número de nodos y m es el promedio de elementos por nodo.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::printInOrder() const {
+    printInOrderHelper(root);
+}
+
+/*
+    funcion: printInOrderHelper
+    Descripcion: Función auxiliar recursiva para imprimir el árbol en orden.
+    Parametros:
+        - node (RankingNode<Key>*): Raíz del subárbol a imprimir.
+    Return: N/A
+    Complejidad: O(n * m), donde n es el número de nodos y m es el promedio de elementos por nodo.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::printInOrderHelper(RankingNode<Key>* node) const {
+    if (node == nullptr) return;
+    
+    printInOrderHelper(node->left);
+    
+    std::cout << KeyOf::keyLabel() << ": " << node->key << " | " << KeyOf::itemsLabel() << ": ";
+    printBucketNames(node);
+    std::cout << std::endl;
+    
+    printInOrderHelper(node->right);
+}
+
+/*
+    funcion: printInReverseOrder
+    Descripcion: Imprime todos los elementos del árbol en orden descendente por llave.
+                 Útil para mostrar los elementos más populares primero.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(n * m), donde n es el número de nodos y m es el promedio de elementos por nodo.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::printInReverseOrder() const {
+    printInReverseOrderHelper(root);
+}
+
+/*
+    funcion: printInReverseOrderHelper
+    Descripcion: Función auxiliar recursiva para imprimir el árbol en orden inverso (descendente).
+    Parametros:
+        - node (RankingNode<Key>*): Raíz del subárbol a imprimir.
+    Return: N/A
+    Complejidad: O(n * m), donde n es el número de nodos y m es el promedio de elementos por nodo.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::printInReverseOrderHelper(RankingNode<Key>* node) const {
+    if (node == nullptr) return;
+    
+    printInReverseOrderHelper(node->right);
+    
+    std::cout << KeyOf::keyLabel() << ": " << node->key << " | " << KeyOf::itemsLabel() << " (" << node->itemCount << "): ";
+    printBucketNames(node);
+    std::cout << std::endl;
+    
+    printInReverseOrderHelper(node->left);
+}
+
+/*
+    funcion: printBucketNames
+    Descripcion: Imprime, separados por coma, los nombres de los elementos de una cubeta
+                 consultándolos en el catálogo.
+    Parametros:
+        - node (RankingNode<Key>*): Cubeta a imprimir.
+    Return: N/A
+    Complejidad: O(m), donde m es el número de elementos en la cubeta.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::printBucketNames(RankingNode<Key>* node) const {
+    for (int i = 0; i < node->itemCount; ++i) {
+        std::cout << catalog[node->itemIds[i]].getName();
+        if (i < node->itemCount - 1) std::cout << ", ";
+    }
+}
+
+/*
+    funcion: getTopN
+    Descripcion: Obtiene los N elementos con mayor llave, en orden descendente.
+                 Si hay empates, incluye todos los elementos con la misma llave
+                 hasta completar o superar N elementos (sin pasar de la capacidad del buffer).
+                 Los IDs se escriben en un buffer del llamador, por lo que la consulta no
+                 reserva memoria.
+    Parametros:
+        - n (int): Número de elementos a obtener (aproximado si hay empates).
+        - resultIds (int*): Buffer donde se escriben los IDs de los elementos.
+        - capacity (int): Tamaño del buffer.
+    Return: (int) Cantidad de IDs escritos en el buffer.
+    Complejidad: O(h + k), donde h es la altura del árbol y k es el número de elementos recolectados.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+int RankingTree<Item, Key, KeyOf, Compare>::getTopN(int n, int* resultIds, int capacity) const {
+    if (root == nullptr || n <= 0 || resultIds == nullptr || capacity <= 0) return 0;
+    
+    int resultCount = 0;
+    int remaining = n;
+    collectTopN(root, remaining, resultIds, capacity, resultCount);
+    return resultCount;
+}
+
+/*
+    funcion: collectTopN
+    Descripcion: Función auxiliar recursiva que recolecta los N elementos con mayor llave
+                 en orden descendente (recorrido in-order inverso).
+    Parametros:
+        - node (RankingNode<Key>*): Raíz del subárbol actual.
+        - remaining (int&): Número de elementos que aún faltan por recolectar.
+        - resultIds (int*): Buffer donde se almacenan los IDs.
+        - capacity (int): Tamaño del buffer.
+        - resultCount (int&): Contador de elementos recolectados.
+    Return: N/A (los resultados se devuelven por referencia)
+    Complejidad: O(h + k), donde h es la altura y k es el número de elementos recolectados.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::collectTopN(RankingNode<Key>* node, int& remaining, int* resultIds, int capacity, int& resultCount) const {
+    if (node == nullptr || remaining <= 0) return;
+    
+    // Primero visitar el subárbol derecho (valores mayores)
+    collectTopN(node->right, remaining, resultIds, capacity, resultCount);
+    
+    // Si aún necesitamos más elementos
+    if (remaining > 0) {
+        // Agregar todos los elementos de este nodo
+        for (int i = 0; i < node->itemCount && resultCount < capacity; ++i) {
+            resultIds[resultCount++] = node->itemIds[i];
+        }
+        remaining -= node->itemCount;
+    }
+    
+    // Luego visitar el subárbol izquierdo (valores menores)
+    collectTopN(node->left, remaining, resultIds, capacity, resultCount);
+}
+
+/*
+    funcion: getTotalItems
+    Descripcion: Devuelve el número total de elementos en el árbol.
+    Parametros: Ninguno
+    Return: (int) Total de elementos.
+    Complejidad: O(1)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+int RankingTree<Item, Key, KeyOf, Compare>::getTotalItems() const {
+    return getSubtreeItems(root);
+}
+
+/*
+    funcion: countBelow
+    Descripcion: Cuenta los elementos con llave menor que 'key' (o menor o igual si
+                 'inclusive' es true), sumando los totales de subárbol de los nodos que
+                 quedan a la izquierda del camino.
+    Parametros:
+        - key (const Key&): Llave de referencia.
+        - inclusive (bool): Si es true también cuenta los elementos con llave igual.
+    Return: (int) Cantidad de elementos que cumplen la condición.
+    Complejidad: O(h), donde h es la altura del árbol.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+int RankingTree<Item, Key, KeyOf, Compare>::countBelow(const Key& key, bool inclusive) const {
+    int total = 0;
+    RankingNode<Key>* node = root;
+    while (node != nullptr) {
+        const bool goLeft = inclusive ? Compare::less(key, node->key) : !Compare::less(node->key, key);
+        if (goLeft) {
+            node = node->left;
+        } else {
+            total += getSubtreeItems(node->left) + node->itemCount;
+            node = node->right;
+        }
+    }
+    return total;
+}
+
+/*
+    funcion: getRank
+    Descripcion: Obtiene la posición de un elemento en el ranking
+                 (1 = mayor llave). Los empates comparten la misma posición.
+    Parametros:
+        - itemId (int): ID del elemento en el catálogo.
+    Return: (int) Posición en el ranking, -1 si el elemento no está en el árbol.
+    Complejidad: O(h), donde h es la altura del árbol.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+int RankingTree<Item, Key, KeyOf, Compare>::getRank(int itemId) const {
+    if (!containsItem(itemId)) return -1;
+    return getTotalItems() - countBelow(nodeOfItem[itemId]->key, true) + 1;
+}
+
+/*
+    funcion: countInRange
+    Descripcion: Cuenta los elementos cuya llave está en [minKey, maxKey]
+                 (ej. elementos con entre 50 y 100 pedidos).
+    Parametros:
+        - minKey (const Key&): Límite inferior (inclusivo).
+        - maxKey (const Key&): Límite superior (inclusivo).
+    Return: (int) Cantidad de elementos en el rango, 0 si el rango es inválido.
+    Complejidad: O(h), donde h es la altura del árbol.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+int RankingTree<Item, Key, KeyOf, Compare>::countInRange(const Key& minKey, const Key& maxKey) const {
+    if (Compare::less(maxKey, minKey)) return 0;
+    return countBelow(maxKey, true) - countBelow(minKey, false);
+}
+
+/*
+    funcion: selectByPosition
+    Descripcion: Encuentra la cubeta que contiene al elemento en la posición indicada
+                 del orden ascendente por llave (0 = menor llave).
+    Parametros:
+        - position (int): Posición, entre 0 y getTotalItems() - 1.
+    Return: (RankingBucketView<Key>) Vista de la cubeta; itemCount = 0 si la posición es inválida.
+    Complejidad: O(h), donde h es la altura del árbol.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+RankingBucketView<Key> RankingTree<Item, Key, KeyOf, Compare>::selectByPosition(int position) const {
+    RankingBucketView<Key> view = {Key(), nullptr, 0};
+    if (position < 0 || position >= getTotalItems()) return view;
+
+    RankingNode<Key>* node = root;
+    while (node != nullptr) {
+        const int leftDishes = getSubtreeItems(node->left);
+        if (position < leftDishes) {
+            node = node->left;
+        } else if (position < leftDishes + node->itemCount) {
+            view.key = node->key;
+            view.itemIds = node->itemIds;
+            view.itemCount = node->itemCount;
+            return view;
+        } else {
+            position -= leftDishes + node->itemCount;
+            node = node->right;
+        }
+    }
+    return view;
+}
+
+/*
+    funcion: getPercentile
+    Descripcion: Encuentra los elementos que están en el percentil de popularidad indicado,
+                 es decir, la cubeta que contiene al elemento por debajo del cual queda el
+                 'percentile' por ciento de los elementos.
+    Parametros:
+        - percentile (double): Percentil entre 0 y 100.
+    Return: (RankingBucketView<Key>) Vista de la cubeta; itemCount = 0 si el árbol está vacío.
+    Complejidad: O(h), donde h es la altura del árbol.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+RankingBucketView<Key> RankingTree<Item, Key, KeyOf, Compare>::getPercentile(double percentile) const {
+    const int total = getTotalItems();
+    if (percentile < 0) percentile = 0;
+    if (percentile > 100) percentile = 100;
+
+    int position = static_cast<int>(std::ceil(percentile / 100.0 * total)) - 1;
+    if (position < 0) position = 0;
+    if (position >= total) position = total - 1;
+    return selectByPosition(position);
+}
+
+/*
+    funcion: getHeight
+    Descripcion: Obtiene la altura del subárbol cuyo nodo raíz es el indicado. La altura
+                 se guarda en cada nodo y se mantiene al insertar, eliminar y rotar.
+    Parametros:
+        - node (RankingNode<Key>*): Nodo raíz del subárbol del que se desea la altura.
+    Return: (int) Altura del subárbol; 0 si el nodo es nulo.
+    Complejidad: O(1)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+int RankingTree<Item, Key, KeyOf, Compare>::getHeight(RankingNode<Key> *node) const {
+    if (node == nullptr) return 0;
+    return node->height;
+}
+
+/*
+    funcion: balanceWholeTree
+    Descripcion: Balancea recursivamente todo el árbol verificando y corrigiendo
+                 desequilibrios en cada nodo mediante rotaciones AVL simples o dobles.
+    Parametros:
+        - node (RankingNode<Key>*&): Referencia al puntero del subárbol actual a balancear.
+    Return: N/A
+    Complejidad: O(n), donde n es el número de nodos porque visita cada nodo una vez.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::balanceWholeTree(RankingNode<Key>*& node){
+  if (node == nullptr) return;
+  balanceWholeTree(node->left);
+  balanceWholeTree(node->right);
+  updateMetrics(node);
+  const int balance = getBalanceFactor(node);
+
+  if (balance > 1) {
+      if (node->left != nullptr && getBalanceFactor(node->left) < 0) {
+          rotateLeft(node->left);
+      }
+      rotateRight(node);
+  } else if (balance < -1) {
+      if (node->right != nullptr && getBalanceFactor(node->right) > 0) {
+          rotateRight(node->right);
+      }
+      rotateLeft(node);
+  }
+}
+
+/*
+    funcion: balanceSubtree
+    Descripcion: Balancea únicamente el subárbol dado aplicando rotaciones cuando
+                 el factor de balance excede el rango permitido en un árbol AVL.
+    Parametros:
+        - node (RankingNode<Key>*&): Referencia al subárbol que se desea balancear.
+    Return: N/A
+    Complejidad: O(h), donde h es la altura del subárbol evaluado.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::balanceSubtree(RankingNode<Key>*& node) {
+  if (node == nullptr) return;
+  updateMetrics(node);
+  const int balance = getBalanceFactor(node);
+
+  if (balance > 1) {
+    if (node->left != nullptr && getBalanceFactor(node->left) < 0) {
+      rotateLeft(node->left);
+    }
+    rotateRight(node);
+  } else if (balance < -1) {
+    if (node->right != nullptr && getBalanceFactor(node->right) > 0) {
+      rotateRight(node->right);
+    }
+    rotateLeft(node);
+  }
+}
+
+/*
+        funcion: rotateLeft
+        Descripcion: Realiza una rotación simple a la izquierda sobre el nodo indicado
+                                 para corregir un desequilibrio hacia la derecha.
+        Parametros:
+                - node (RankingNode<Key>*&): Referencia al nodo que actuará como pivote de la rotación.
+        Return: N/A
+        Complejidad: O(1)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::rotateLeft(RankingNode<Key> *&node) {
+  RankingNode<Key> *rightChild = node->right;
+  node->right = rightChild->left;
+  rightChild->left = node;
+  updateMetrics(node);
+  updateMetrics(rightChild);
+  node = rightChild;
+}
+
+/*
+        funcion: rotateRight
+        Descripcion: Realiza una rotación simple a la derecha sobre el nodo indicado
+                                 para corregir un desequilibrio hacia la izquierda.
+        Parametros:
+                - node (RankingNode<Key>*&): Referencia al nodo pivote de la rotación.
+        Return: N/A
+        Complejidad: O(1)
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::rotateRight(RankingNode<Key> *&node) {
+  RankingNode<Key> *leftChild = node->left;
+  node->left = leftChild->right;
+  leftChild->right = node;
+  updateMetrics(node);
+  updateMetrics(leftChild);
+  node = leftChild;
+}
+
+/*
+        funcion: getBalanceFactor
+        Descripcion: Calcula el factor de balance de un nodo como la diferencia entre
+                                 las alturas de sus subárboles izquierdo y derecho.
+        Parametros:
+                - node (RankingNode<Key>*): Nodo del cual se requiere el factor de balance.
+        Return: (int) Diferencia de alturas izquierda - derecha.
+        Complejidad: O(1), las alturas están almacenadas en los nodos.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+int RankingTree<Item, Key, KeyOf, Compare>::getBalanceFactor(RankingNode<Key> *node) const {
+  if (node == nullptr) return 0;
+    const int leftSubTreeDepth = getHeight(node->left);
+    const int rightSubTreeDepth = getHeight(node->right);
+    return leftSubTreeDepth - rightSubTreeDepth;
+}
+
+/*
+        funcion: showStatistics
+        Descripcion: Imprime en consola métricas básicas del árbol, como el factor de balance
+                                 de la raíz y la estructura de sus nodos.
+        Parametros: Ninguno
+        Return: N/A
+        Complejidad: O(n), debido a que recorre los nodos para mostrarlos.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::showStatistics() const {
+  std::cout << "Balance factor: " << getBalanceFactor(root) << std::endl;
+  printNodes();
+}
+
+/*
+        funcion: printNodes
+        Descripcion: Inicia la impresión recursiva de cada nodo y sus conexiones para
+                                 visualizar la estructura del árbol.
+        Parametros: Ninguno
+        Return: N/A
+        Complejidad: O(n), donde n es la cantidad de nodos impresos.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::printNodes() const {
+  printNodeHelper(root);
+}
+
+/*
+        funcion: printNodeHelper
+        Descripcion: Función auxiliar que imprime la información de un nodo, mostrando
+                                 los valores de sus hijos izquierdo y derecho, y recorre el árbol recursivamente.
+        Parametros:
+                - node (RankingNode<Key>*): Nodo actual que se va a imprimir.
+        Return: N/A
+        Complejidad: O(n), ya que visita cada nodo exactamente una vez.
+*/
+template <typename Item, typename Key, typename KeyOf, typename Compare>
+void RankingTree<Item, Key, KeyOf, Compare>::printNodeHelper(RankingNode<Key> *node) const {
+  std::cout << node->key << " | izq: ";
+  if (node->left != nullptr) std::cout << node->left->key; else std::cout << -1;
+  std::cout << " | der: ";
+  if (node->right != nullptr) std::cout << node->right->key; else std::cout << -1;
+  std::cout << std::endl;
+  if (node->left != nullptr) printNodeHelper(node->left);
+  if (node->right != nullptr) printNodeHelper(node->right);
+}
+
+#endif // RANKINGTREEIMPL_HPP
@@ -0,0 +1,42 @@
+#ifndef RANKINGS_HPP
+#define RANKINGS_HPP
+
+#include "Restaurant.hpp"
+#include "HourSlot.hpp"
+#include "RankingTree.hpp"
+
+/*
+    struct: RestaurantOrderKey
+    Descripcion: Llave del ranking de restaurantes por número de pedidos.
+*/
+struct RestaurantOrderKey {
+    static int keyOf(const Restaurant& restaurant) { return restaurant.getTotalOrders(); }
+    static const char* keyLabel() { return "Pedidos"; }
+    static const char* itemsLabel() { return "Restaurantes"; }
+};
+
+/*
+    struct: RestaurantRevenueKey
+    Descripcion: Llave del ranking de restaurantes por ingresos (suma de precios).
+*/
+struct RestaurantRevenueKey {
+    static long long keyOf(const Restaurant& restaurant) { return restaurant.getRevenue(); }
+    static const char* keyLabel() { return "Ingresos"; }
+    static const char* itemsLabel() { return "Restaurantes"; }
+};
+
+/*
+    struct: HourOrderKey
+    Descripcion: Llave del ranking por hora del día: número de pedidos en esa hora.
+*/
+struct HourOrderKey {
+    static int keyOf(const HourSlot& slot) { return slot.getTotalOrders(); }
+    static const char* keyLabel() { return "Pedidos"; }
+    static const char* itemsLabel() { return "Horas"; }
+};
+
+typedef RankingTree<Restaurant, int, RestaurantOrderKey> RestaurantOrdersRanking;
+typedef RankingTree<Restaurant, long long, RestaurantRevenueKey> RestaurantRevenueRanking;
+typedef RankingTree<HourSlot, int, HourOrderKey> HourRanking;
+
+#endif // RANKINGS_HPP
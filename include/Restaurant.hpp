@@ -0,0 +1,21 @@
+#ifndef RESTAURANT_HPP
+#define RESTAURANT_HPP
+
+#include "CustomString.hpp"
+
+class Restaurant {
+public:
+    Restaurant();
+    Restaurant(String name);
+    String getName() const;
+    int getTotalOrders() const;
+    long long getRevenue() const;
+    void addOrder(int price);
+    void removeOrder(int price);
+private:
+    String name;
+    int totalOrders = 0;
+    long long revenue = 0;
+};
+
+#endif
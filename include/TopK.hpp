@@ -0,0 +1,30 @@
+#ifndef TOPK_HPP
+#define TOPK_HPP
+
+/*
+    funcion: insertarEnTop
+    Descripcion: Inserta un candidato en un top ordenado de tamaño máximo 'capacidad'
+                 (inserción directa). Si el top está lleno y el candidato no va antes
+                 que el último, se descarta.
+    Parametros:
+        - top: Arreglo ordenado de hasta 'capacidad' elementos
+        - cuenta: Elementos actualmente en el top
+        - capacidad: Tamaño máximo del top (mayor que 0)
+        - candidato: Elemento a insertar
+        - vaAntes: vaAntes(a, b) es true si 'a' debe quedar antes que 'b'
+    Return: N/A
+    Complejidad: O(capacidad)
+*/
+template <typename T, typename Orden>
+inline void insertarEnTop(T* top, int& cuenta, int capacidad, const T& candidato, Orden vaAntes) {
+    if (cuenta == capacidad && !vaAntes(candidato, top[capacidad - 1])) return;
+
+    int posicion = (cuenta < capacidad) ? cuenta++ : capacidad - 1;
+    while (posicion > 0 && vaAntes(candidato, top[posicion - 1])) {
+        top[posicion] = top[posicion - 1];
+        posicion--;
+    }
+    top[posicion] = candidato;
+}
+
+#endif // TOPK_HPP
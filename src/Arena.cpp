@@ -0,0 +1,109 @@
+#include "Arena.hpp"
+
+/*
+    funcion: Arena (Constructor)
+    Descripcion: Inicializa una arena vacía. El primer bloque se reserva hasta la primera
+                 asignación, así una arena sin uso no ocupa memoria.
+    Parametros:
+        - chunkBytes (size_t): Tamaño de cada bloque (default = 64 KB).
+    Return: N/A
+    Complejidad: O(1)
+*/
+Arena::Arena(size_t chunkBytes)
+    : first(nullptr), current(nullptr), offset(0), chunkBytes(chunkBytes > 0 ? chunkBytes : 1024) {
+}
+
+/*
+    funcion: ~Arena (Destructor)
+    Descripcion: Libera todos los bloques de la arena.
+    Complejidad: O(b), donde b es el número de bloques.
+*/
+Arena::~Arena() {
+    Chunk* chunk = first;
+    while (chunk != nullptr) {
+        Chunk* next = chunk->next;
+        ::operator delete(chunk);
+        chunk = next;
+    }
+}
+
+/*
+    funcion: dataOf
+    Descripcion: Devuelve el inicio de la zona útil de un bloque (después del encabezado).
+    Parametros:
+        - chunk (Chunk*): Bloque.
+    Return: (char*) Primer byte utilizable del bloque.
+    Complejidad: O(1)
+*/
+char* Arena::dataOf(Chunk* chunk) {
+    return reinterpret_cast<char*>(chunk) + sizeof(Chunk);
+}
+
+/*
+    funcion: newChunk
+    Descripcion: Reserva un bloque nuevo con al menos 'minBytes' útiles.
+    Parametros:
+        - minBytes (size_t): Tamaño mínimo requerido.
+    Return: (Chunk*) Bloque reservado, sin enlazar.
+    Complejidad: O(1)
+*/
+Arena::Chunk* Arena::newChunk(size_t minBytes) {
+    const size_t size = minBytes > chunkBytes ? minBytes : chunkBytes;
+    Chunk* chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk) + size));
+    chunk->next = nullptr;
+    chunk->size = size;
+    return chunk;
+}
+
+/*
+    funcion: allocate
+    Descripcion: Reserva 'bytes' bytes alineados dentro del bloque actual. Si no caben,
+                 pasa al siguiente bloque conservado de una construcción anterior o, si
+                 tampoco alcanza, reserva uno nuevo y lo enlaza después del actual.
+    Parametros:
+        - bytes (size_t): Cantidad de bytes.
+        - alignment (size_t): Alineación requerida (potencia de 2).
+    Return: (void*) Memoria reservada, válida hasta reset() o la destrucción de la arena.
+    Complejidad: O(1) amortizado.
+*/
+void* Arena::allocate(size_t bytes, size_t alignment) {
+    const size_t worstCase = bytes + alignment;
+
+    if (current == nullptr) {
+        first = current = newChunk(worstCase);
+        offset = 0;
+    }
+
+    size_t aligned = (offset + alignment - 1) & ~(alignment - 1);
+    if (aligned + bytes > current->size) {
+        if (current->next != nullptr && current->next->size >= worstCase) {
+            current = current->next;
+        } else {
+            Chunk* chunk = newChunk(worstCase);
+            chunk->next = current->next;
+            current->next = chunk;
+            current = chunk;
+        }
+        offset = 0;
+        aligned = 0;
+    }
+
+    // dataOf() queda alineado a max_align_t; el desplazamiento conserva la alineación pedida
+    void* result = dataOf(current) + aligned;
+    offset = aligned + bytes;
+    return result;
+}
+
+/*
+    funcion: reset
+    Descripcion: Descarta todo lo asignado regresando al primer bloque. Los bloques se
+                 conservan para la siguiente construcción, así que no se libera nada uno
+                 por uno.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(1)
+*/
+void Arena::reset() {
+    current = first;
+    offset = 0;
+}
@@ -0,0 +1,313 @@
+#include "CaminosPonderados.hpp"
+#include <iostream>
+
+/*
+    funcion: CaminosPonderados (Constructor)
+    Descripcion: Inicializa el buscador sin arreglos; se reservan en la primera consulta.
+    Complejidad: O(1)
+*/
+CaminosPonderados::CaminosPonderados()
+    : capacidad(0), epoca(0), nodosExplorados(0), bufferCamino(nullptr), capacidadBuffer(0) {
+    for (int lado = 0; lado < 2; ++lado) {
+        distancia[lado] = nullptr;
+        padre[lado] = nullptr;
+        alcanzado[lado] = nullptr;
+        cerrado[lado] = nullptr;
+    }
+}
+
+/*
+    funcion: ~CaminosPonderados (Destructor)
+    Descripcion: Libera los arreglos de trabajo.
+    Complejidad: O(1)
+*/
+CaminosPonderados::~CaminosPonderados() {
+    for (int lado = 0; lado < 2; ++lado) {
+        delete[] distancia[lado];
+        delete[] padre[lado];
+        delete[] alcanzado[lado];
+        delete[] cerrado[lado];
+    }
+    delete[] bufferCamino;
+}
+
+/*
+    funcion: costoArista
+    Descripcion: Costo de recorrer una arista: el inverso de sus pedidos. Una relación pedida
+                 10 veces cuesta 0.1 y una pedida una vez cuesta 1.
+    Parametros:
+        - peso: Pedidos de la arista (>= 1)
+    Return: 1 / peso
+    Complejidad: O(1)
+*/
+double CaminosPonderados::costoArista(int peso) {
+    return 1.0 / static_cast<double>(peso);
+}
+
+/*
+    funcion: prepararConsulta
+    Descripcion: Crece los arreglos si el grafo creció, vacía los montículos y avanza la
+                 época para invalidar las distancias de la consulta anterior.
+    Parametros:
+        - numNodos: Nodos actuales del grafo
+    Complejidad: O(1) amortizado, O(V) cuando crece o cuando la época da la vuelta
+*/
+void CaminosPonderados::prepararConsulta(int numNodos) {
+    if (numNodos > capacidad) {
+        int nuevaCapacidad = capacidad > 0 ? capacidad : 64;
+        while (nuevaCapacidad < numNodos) {
+            nuevaCapacidad *= 2;
+        }
+        for (int lado = 0; lado < 2; ++lado) {
+            delete[] distancia[lado];
+            delete[] padre[lado];
+            delete[] alcanzado[lado];
+            delete[] cerrado[lado];
+            distancia[lado] = new double[nuevaCapacidad];
+            padre[lado] = new int[nuevaCapacidad];
+            alcanzado[lado] = new int[nuevaCapacidad];
+            cerrado[lado] = new int[nuevaCapacidad];
+            for (int i = 0; i < nuevaCapacidad; ++i) {
+                alcanzado[lado][i] = 0;
+                cerrado[lado][i] = 0;
+            }
+            monticulo[lado].reservar(nuevaCapacidad);
+        }
+        capacidad = nuevaCapacidad;
+        epoca = 0;
+    }
+
+    if (epoca == 2147483647) {
+        for (int lado = 0; lado < 2; ++lado) {
+            for (int i = 0; i < capacidad; ++i) {
+                alcanzado[lado][i] = 0;
+                cerrado[lado][i] = 0;
+            }
+        }
+        epoca = 0;
+    }
+    epoca++;
+    monticulo[ADELANTE].vaciar();
+    monticulo[ATRAS].vaciar();
+    nodosExplorados = 0;
+}
+
+/*
+    funcion: alcanzar
+    Descripcion: Relaja un nodo en una de las dos búsquedas: si la nueva distancia mejora la
+                 que tenía (o no tenía), la guarda junto con su padre y lo mete al montículo.
+    Parametros:
+        - lado: ADELANTE o ATRAS
+        - nodo: Nodo alcanzado
+        - nuevaDistancia: Distancia por el camino recién encontrado
+        - nodoPadre: Nodo desde el que se llegó (-1 para el nodo inicial)
+    Complejidad: O(log V)
+*/
+void CaminosPonderados::alcanzar(int lado, int nodo, double nuevaDistancia, int nodoPadre) {
+    if (alcanzado[lado][nodo] == epoca && distancia[lado][nodo] <= nuevaDistancia) return;
+    alcanzado[lado][nodo] = epoca;
+    distancia[lado][nodo] = nuevaDistancia;
+    padre[lado][nodo] = nodoPadre;
+    monticulo[lado].insertarOReducir(nodo, nuevaDistancia);
+}
+
+/*
+    funcion: reconstruir
+    Descripcion: Arma el camino origen -> ultimoAdelante siguiendo los padres de la búsqueda
+                 hacia adelante y, si primeroAtras != -1, lo continúa primeroAtras -> destino
+                 con los padres de la búsqueda hacia atrás.
+    Parametros:
+        - ultimoAdelante: Último nodo de la parte hacia adelante
+        - primeroAtras: Primer nodo de la parte hacia atrás, -1 si no hay
+        - camino: Buffer de salida (origen primero)
+        - capacidadCamino: Tamaño del buffer; los nodos que no caben no se escriben
+    Return: Número de nodos del camino completo
+    Complejidad: O(longitud del camino)
+*/
+int CaminosPonderados::reconstruir(int ultimoAdelante, int primeroAtras, int* camino, int capacidadCamino) const {
+    int longitudAdelante = 0;
+    for (int v = ultimoAdelante; v != -1; v = padre[ADELANTE][v]) {
+        longitudAdelante++;
+    }
+
+    int i = longitudAdelante - 1;
+    for (int v = ultimoAdelante; v != -1; v = padre[ADELANTE][v], --i) {
+        if (i < capacidadCamino) camino[i] = v;
+    }
+
+    int longitud = longitudAdelante;
+    for (int v = primeroAtras; v != -1; v = padre[ATRAS][v]) {
+        if (longitud < capacidadCamino) camino[longitud] = v;
+        longitud++;
+    }
+    return longitud;
+}
+
+/*
+    funcion: dijkstra
+    Descripcion: Camino de menor costo entre dos nodos con Dijkstra desde el origen. Se
+                 detiene en cuanto el destino sale del montículo.
+    Parametros:
+        - grafo: Grafo Platillo-Restaurante
+        - origen, destino: IDs de los nodos
+        - camino: Buffer para los nodos del camino (origen primero)
+        - capacidadCamino: Tamaño del buffer
+        - costo: Recibe el costo total del camino
+    Return: Número de nodos del camino, 0 si no hay camino, -1 si algún ID es inválido
+    Complejidad: O((V + E) log V) en el peor caso; en la práctica sólo lo explorado
+*/
+int CaminosPonderados::dijkstra(const Graph& grafo, int origen, int destino, int* camino, int capacidadCamino, double& costo) {
+    const int n = grafo.getNumNodos();
+    costo = 0.0;
+    if (origen < 0 || origen >= n || destino < 0 || destino >= n) return -1;
+
+    const GrafoCSR& g = grafo.obtenerCSR();
+    prepararConsulta(n);
+
+    MonticuloIndexado& cola = monticulo[ADELANTE];
+    double* dist = distancia[ADELANTE];
+    alcanzar(ADELANTE, origen, 0.0, -1);
+
+    while (!cola.vacio()) {
+        const int u = cola.extraerMinimo();
+        cerrado[ADELANTE][u] = epoca;
+        nodosExplorados++;
+        if (u == destino) {
+            costo = dist[u];
+            return reconstruir(destino, -1, camino, capacidadCamino);
+        }
+        for (int k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+            const int v = g.vecinos[k];
+            if (cerrado[ADELANTE][v] == epoca) continue;
+            alcanzar(ADELANTE, v, dist[u] + costoArista(g.pesos[k]), u);
+        }
+    }
+    return 0;
+}
+
+/*
+    funcion: dijkstraBidireccional
+    Descripcion: Camino de menor costo entre dos nodos buscando a la vez desde el origen y
+                 desde el destino (el grafo es no dirigido, así que ambas búsquedas usan el
+                 mismo CSR). Las dos búsquedas se encuentran a la mitad y cada una explora
+                 un radio de más o menos la mitad del costo total.
+
+    ALGORITMO:
+    1. Montículo hacia adelante con el origen y hacia atrás con el destino; mejor = infinito
+    2. Mientras ningún montículo esté vacío y minAdelante + minAtras < mejor:
+       - Cerrar el nodo u del lado con la clave mínima más chica
+       - Relajar cada arista (u, v); si v ya tiene distancia del otro lado, el camino
+         d(u) + costo(u, v) + dOtro(v) es candidato a mejor
+    3. Si mejor sigue en infinito no hay camino; si no, unir los dos medios caminos por la
+       arista del mejor candidato
+
+    Parametros: Igual que dijkstra
+    Return: Número de nodos del camino, 0 si no hay camino, -1 si algún ID es inválido
+    Complejidad: O((V + E) log V) en el peor caso
+*/
+int CaminosPonderados::dijkstraBidireccional(const Graph& grafo, int origen, int destino, int* camino, int capacidadCamino, double& costo) {
+    const int n = grafo.getNumNodos();
+    costo = 0.0;
+    if (origen < 0 || origen >= n || destino < 0 || destino >= n) return -1;
+
+    const GrafoCSR& g = grafo.obtenerCSR();
+    prepararConsulta(n);
+    if (origen == destino) {
+        alcanzar(ADELANTE, origen, 0.0, -1);
+        nodosExplorados = 1;
+        return reconstruir(origen, -1, camino, capacidadCamino);
+    }
+
+    alcanzar(ADELANTE, origen, 0.0, -1);
+    alcanzar(ATRAS, destino, 0.0, -1);
+
+    double mejor = 0.0;
+    bool hayCamino = false;
+    int encuentroAdelante = -1;   // Arista del mejor camino: encuentroAdelante - encuentroAtras
+    int encuentroAtras = -1;
+
+    while (!monticulo[ADELANTE].vacio() && !monticulo[ATRAS].vacio()) {
+        const double minAdelante = monticulo[ADELANTE].claveMinima();
+        const double minAtras = monticulo[ATRAS].claveMinima();
+        if (hayCamino && minAdelante + minAtras >= mejor) break;
+
+        const int lado = (minAdelante <= minAtras) ? ADELANTE : ATRAS;
+        const int otro = 1 - lado;
+        const int u = monticulo[lado].extraerMinimo();
+        cerrado[lado][u] = epoca;
+        nodosExplorados++;
+
+        const double du = distancia[lado][u];
+        for (int k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+            const int v = g.vecinos[k];
+            const double dv = du + costoArista(g.pesos[k]);
+            if (cerrado[lado][v] != epoca) {
+                alcanzar(lado, v, dv, u);
+            }
+            if (alcanzado[otro][v] == epoca) {
+                const double candidato = dv + distancia[otro][v];
+                if (!hayCamino || candidato < mejor) {
+                    mejor = candidato;
+                    hayCamino = true;
+                    encuentroAdelante = (lado == ADELANTE) ? u : v;
+                    encuentroAtras = (lado == ADELANTE) ? v : u;
+                }
+            }
+        }
+    }
+
+    if (!hayCamino) return 0;
+    costo = mejor;
+    return reconstruir(encuentroAdelante, encuentroAtras, camino, capacidadCamino);
+}
+
+/*
+    funcion: imprimirCamino
+    Descripcion: Muestra el camino de conexiones más fuertes entre dos nodos, con los
+                 pedidos de cada arista, el costo total y los nodos que exploró la búsqueda.
+                 El camino se arma en un buffer que se guarda entre consultas y sólo crece
+                 con el grafo.
+    Parametros:
+        - grafo: Grafo Platillo-Restaurante
+        - origen, destino: IDs de los nodos
+        - bidireccional: true para Dijkstra bidireccional, false para Dijkstra desde el origen
+    Complejidad: O((V + E) log V) en el peor caso
+*/
+void CaminosPonderados::imprimirCamino(const Graph& grafo, int origen, int destino, bool bidireccional) {
+    const int n = grafo.getNumNodos();
+    if (n > capacidadBuffer) {
+        delete[] bufferCamino;
+        bufferCamino = new int[n];
+        capacidadBuffer = n;
+    }
+    int* camino = bufferCamino;
+    double costo = 0.0;
+    const int longitud = bidireccional ? dijkstraBidireccional(grafo, origen, destino, camino, n, costo)
+                                       : dijkstra(grafo, origen, destino, camino, n, costo);
+
+    if (longitud <= 0) {
+        std::cout << "No hay camino entre " << grafo.getNombreNodo(origen) << " y "
+                  << grafo.getNombreNodo(destino) << "." << std::endl;
+        return;
+    }
+
+    const GrafoCSR& g = grafo.obtenerCSR();
+    std::cout << "\n===== Camino más fuerte: " << grafo.getNombreNodo(origen) << " -> "
+              << grafo.getNombreNodo(destino) << " =====" << std::endl;
+    std::cout << "  " << grafo.getNombreNodo(camino[0]) << " (" << grafo.getTipoNodo(camino[0]) << ")" << std::endl;
+    for (int i = 1; i < longitud; ++i) {
+        int pedidos = 0;
+        for (int k = g.offsets[camino[i - 1]]; k < g.offsets[camino[i - 1] + 1]; ++k) {
+            if (g.vecinos[k] == camino[i]) {
+                pedidos = g.pesos[k];
+                break;
+            }
+        }
+        std::cout << "   --" << pedidos << " pedidos--> " << grafo.getNombreNodo(camino[i])
+                  << " (" << grafo.getTipoNodo(camino[i]) << ")" << std::endl;
+    }
+    std::cout << "Saltos: " << longitud - 1 << " | Costo total (suma de 1/pedidos): " << costo << std::endl;
+    std::cout << "Nodos explorados (" << (bidireccional ? "Dijkstra bidireccional" : "Dijkstra") << "): "
+              << nodosExplorados << " de " << n << std::endl;
+    std::cout << "================================================" << std::endl;
+}
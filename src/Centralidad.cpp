@@ -0,0 +1,317 @@
+#include "Centralidad.hpp"
+#include "Hilos.hpp"
+#include "RankingTreeImpl.hpp"
+#include <atomic>
+#include <iostream>
+
+/*
+    funcion: NodoCentral (Constructor)
+    Descripcion: Inicializa un nodo sin puntajes.
+    Complejidad: O(1)
+*/
+NodoCentral::NodoCentral() : nombre(""), tipo(' '), gradoPonderado(0), cercania(0.0), intermediacion(0.0) {
+}
+
+/*
+    funcion: getName
+    Descripcion: Nombre del nodo (lo usan los rankings al imprimir).
+    Return: Nombre del nodo
+    Complejidad: O(L)
+*/
+String NodoCentral::getName() const {
+    return nombre;
+}
+
+/*
+    funcion: Centralidad (Constructor)
+    Descripcion: Inicializa un cálculo vacío.
+    Complejidad: O(1)
+*/
+Centralidad::Centralidad() : numNodos(0), nodos(nullptr) {
+}
+
+/*
+    funcion: ~Centralidad (Destructor)
+    Descripcion: Libera los puntajes.
+    Complejidad: O(V)
+*/
+Centralidad::~Centralidad() {
+    limpiar();
+}
+
+/*
+    funcion: limpiar
+    Descripcion: Descarta los puntajes y vacía los rankings.
+    Complejidad: O(V)
+*/
+void Centralidad::limpiar() {
+    gradoPlatillos.clear();
+    gradoRestaurantes.clear();
+    cercaniaPlatillos.clear();
+    cercaniaRestaurantes.clear();
+    intermediacionPlatillos.clear();
+    intermediacionRestaurantes.clear();
+    delete[] nodos;
+    nodos = nullptr;
+    numNodos = 0;
+}
+
+/*
+    funcion: estaCalculada
+    Descripcion: Indica si ya se calcularon los puntajes.
+    Return: true si hay puntajes disponibles
+    Complejidad: O(1)
+*/
+bool Centralidad::estaCalculada() const {
+    return nodos != nullptr;
+}
+
+/*
+    funcion: calcular
+    Descripcion: Calcula las tres métricas para todos los nodos y arma los rankings.
+    Parametros:
+        - grafo: Grafo Platillo-Restaurante
+        - numHilos: Hilos a usar; 0 usa todos los núcleos
+    Complejidad: O(V * E / hilos) por los BFS de todos los orígenes
+*/
+void Centralidad::calcular(const Graph& grafo, int numHilos) {
+    limpiar();
+
+    numNodos = grafo.getNumNodos();
+    nodos = new NodoCentral[numNodos > 0 ? numNodos : 1];
+    for (int i = 0; i < numNodos; ++i) {
+        nodos[i].nombre = grafo.getNombreNodo(i);
+        nodos[i].tipo = grafo.getTipoNodo(i);
+        nodos[i].gradoPonderado = grafo.getPesoNodo(i);
+    }
+
+    calcularCaminos(grafo.obtenerCSR(), numHilos);
+    construirRankings();
+}
+
+/*
+    funcion: calcularCaminos
+    Descripcion: Cercanía e intermediación con el algoritmo de Brandes.
+
+    ALGORITMO (por cada origen s):
+    1. BFS desde s: distancia de cada nodo y sigma = número de caminos más cortos desde s.
+       Si w se descubre desde v en el nivel siguiente, sigma[w] += sigma[v]
+    2. Cercanía de s con la suma de distancias y los nodos alcanzados
+    3. Recorrer los nodos en orden inverso de BFS acumulando la dependencia:
+       delta[v] += sigma[v] / sigma[w] * (1 + delta[w]) para cada v un nivel antes que w;
+       intermediación[w] += delta[w]
+
+    Los predecesores no se guardan: en el paso 3 se revisan los vecinos de w en el CSR
+    y se toman los que están un nivel antes. Sólo se reinician las casillas que tocó el
+    BFS. Como el grafo es no dirigido, cada par se cuenta dos veces y al final se divide
+    entre 2.
+
+    Parametros:
+        - g: CSR del grafo
+        - numHilos: Hilos a usar; 0 usa todos los núcleos
+    Complejidad: O(V * E / hilos)
+*/
+void Centralidad::calcularCaminos(const GrafoCSR& g, int numHilos) {
+    const int n = numNodos;
+    if (n == 0) return;
+
+    const int hilos = hilosParaTrabajo(numeroDeHilos(numHilos), n, 16);
+    double* acumuladores = new double[static_cast<long long>(hilos) * n];
+    std::atomic<int> siguienteOrigen(0);
+
+    ejecutarEnHilos(hilos, [&](int h) {
+        double* intermediacion = acumuladores + static_cast<long long>(h) * n;
+        int* distancia = new int[n];
+        double* sigma = new double[n];
+        double* delta = new double[n];
+        int* orden = new int[n];  // Orden de visita del BFS (también sirve de cola)
+        for (int i = 0; i < n; ++i) {
+            intermediacion[i] = 0.0;
+            distancia[i] = -1;
+            sigma[i] = 0.0;
+            delta[i] = 0.0;
+        }
+
+        while (true) {
+            const int s = siguienteOrigen.fetch_add(1);
+            if (s >= n) break;
+
+            // 1. BFS contando caminos más cortos
+            int visitados = 0;
+            long long sumaDistancias = 0;
+            distancia[s] = 0;
+            sigma[s] = 1.0;
+            orden[visitados++] = s;
+            for (int frente = 0; frente < visitados; ++frente) {
+                const int v = orden[frente];
+                for (int k = g.offsets[v]; k < g.offsets[v + 1]; ++k) {
+                    const int w = g.vecinos[k];
+                    if (distancia[w] < 0) {
+                        distancia[w] = distancia[v] + 1;
+                        sumaDistancias += distancia[w];
+                        orden[visitados++] = w;
+                    }
+                    if (distancia[w] == distancia[v] + 1) {
+                        sigma[w] += sigma[v];
+                    }
+                }
+            }
+
+            // 2. Cercanía (cada origen la escribe un solo hilo)
+            if (visitados > 1 && n > 1) {
+                const double alcanzados = static_cast<double>(visitados - 1);
+                nodos[s].cercania = (alcanzados / (n - 1)) * (alcanzados / static_cast<double>(sumaDistancias));
+            } else {
+                nodos[s].cercania = 0.0;
+            }
+
+            // 3. Acumular dependencias en orden inverso
+            for (int i = visitados - 1; i > 0; --i) {
+                const int w = orden[i];
+                const double factor = (1.0 + delta[w]) / sigma[w];
+                for (int k = g.offsets[w]; k < g.offsets[w + 1]; ++k) {
+                    const int v = g.vecinos[k];
+                    if (distancia[v] == distancia[w] - 1) {
+                        delta[v] += sigma[v] * factor;
+                    }
+                }
+                intermediacion[w] += delta[w];
+            }
+
+            // Reiniciar sólo lo que tocó este origen
+            for (int i = 0; i < visitados; ++i) {
+                const int v = orden[i];
+                distancia[v] = -1;
+                sigma[v] = 0.0;
+                delta[v] = 0.0;
+            }
+        }
+
+        delete[] distancia;
+        delete[] sigma;
+        delete[] delta;
+        delete[] orden;
+    });
+
+    // Sumar los acumuladores de todos los hilos
+    for (int v = 0; v < n; ++v) {
+        double total = 0.0;
+        for (int h = 0; h < hilos; ++h) {
+            total += acumuladores[static_cast<long long>(h) * n + v];
+        }
+        nodos[v].intermediacion = total / 2.0;
+    }
+
+    delete[] acumuladores;
+}
+
+/*
+    funcion: construirRankings
+    Descripcion: Inserta cada nodo en los rankings de su tipo.
+    Complejidad: O(V log V)
+*/
+void Centralidad::construirRankings() {
+    gradoPlatillos.setCatalog(nodos);
+    gradoRestaurantes.setCatalog(nodos);
+    cercaniaPlatillos.setCatalog(nodos);
+    cercaniaRestaurantes.setCatalog(nodos);
+    intermediacionPlatillos.setCatalog(nodos);
+    intermediacionRestaurantes.setCatalog(nodos);
+
+    for (int i = 0; i < numNodos; ++i) {
+        if (nodos[i].tipo == 'P') {
+            gradoPlatillos.insert(i);
+            cercaniaPlatillos.insert(i);
+            intermediacionPlatillos.insert(i);
+        } else {
+            gradoRestaurantes.insert(i);
+            cercaniaRestaurantes.insert(i);
+            intermediacionRestaurantes.insert(i);
+        }
+    }
+}
+
+/*
+    funcion: topN
+    Descripcion: Los N nodos de un tipo con mayor puntaje en la métrica dada. Si hay
+                 empates en el lugar N se incluyen todos (hasta la capacidad del buffer).
+    Parametros:
+        - metrica: GRADO_PONDERADO, CERCANIA o INTERMEDIACION
+        - tipo: 'P' para platillos, 'R' para restaurantes
+        - n: Número de lugares
+        - ids: Buffer para los IDs, de mayor a menor puntaje
+        - capacidad: Tamaño del buffer
+    Return: Número de IDs escritos
+    Complejidad: O(h + k), h = altura del ranking, k = nodos recolectados
+*/
+int Centralidad::topN(MetricaCentralidad metrica, char tipo, int n, int* ids, int capacidad) const {
+    const bool platillos = (tipo == 'P');
+    switch (metrica) {
+        case GRADO_PONDERADO:
+            return (platillos ? gradoPlatillos : gradoRestaurantes).getTopN(n, ids, capacidad);
+        case CERCANIA:
+            return (platillos ? cercaniaPlatillos : cercaniaRestaurantes).getTopN(n, ids, capacidad);
+        case INTERMEDIACION:
+            return (platillos ? intermediacionPlatillos : intermediacionRestaurantes).getTopN(n, ids, capacidad);
+    }
+    return 0;
+}
+
+/*
+    funcion: valorDe
+    Descripcion: Puntaje de un nodo en la métrica dada.
+    Parametros:
+        - metrica: Métrica a consultar
+        - id: ID del nodo
+    Return: Puntaje
+    Complejidad: O(1)
+*/
+double Centralidad::valorDe(MetricaCentralidad metrica, int id) const {
+    switch (metrica) {
+        case GRADO_PONDERADO: return nodos[id].gradoPonderado;
+        case CERCANIA: return nodos[id].cercania;
+        case INTERMEDIACION: return nodos[id].intermediacion;
+    }
+    return 0.0;
+}
+
+/*
+    funcion: imprimirTopN
+    Descripcion: Muestra los N platillos o restaurantes más centrales según una métrica.
+    Parametros:
+        - metrica: Métrica del ranking
+        - tipo: 'P' para platillos, 'R' para restaurantes
+        - n: Número de lugares a mostrar
+    Complejidad: O(h + k)
+*/
+void Centralidad::imprimirTopN(MetricaCentralidad metrica, char tipo, int n) const {
+    if (n <= 0) {
+        std::cout << "El número de nodos debe ser mayor que 0." << std::endl;
+        return;
+    }
+
+    const char* nombreMetrica = (metrica == GRADO_PONDERADO) ? WeightedDegreeKey::keyLabel()
+                              : (metrica == CERCANIA) ? ClosenessKey::keyLabel()
+                              : BetweennessKey::keyLabel();
+    const int capacidad = numNodos > 0 ? numNodos : 1;
+    int* ids = new int[capacidad];
+    const int cuenta = topN(metrica, tipo, n, ids, capacidad);
+
+    std::cout << "\n===== " << (tipo == 'P' ? "Platillos" : "Restaurantes") << " más centrales ("
+              << nombreMetrica << ") =====" << std::endl;
+    if (cuenta == 0) {
+        std::cout << "  (no hay nodos de ese tipo)" << std::endl;
+    }
+    for (int i = 0; i < cuenta; ++i) {
+        std::cout << "  " << i + 1 << ". " << nodos[ids[i]].nombre
+                  << " (" << valorDe(metrica, ids[i]) << ")" << std::endl;
+    }
+    std::cout << "================================================" << std::endl;
+
+    delete[] ids;
+}
+
+// Instancias de RankingTree para los rankings de centralidad
+template class RankingTree<NodoCentral, int, WeightedDegreeKey>;
+template class RankingTree<NodoCentral, double, ClosenessKey>;
+template class RankingTree<NodoCentral, double, BetweennessKey>;
@@ -55,3 +55,15 @@ int Dish::getTotalOrders() const {
 void Dish::addOrder() {
     totalOrders++;
 }
+
+/*
+    funcion: removeOrder
+    Descripcion: Decrementa en uno el contador de pedidos del platillo (cancelación).
+                 El contador nunca baja de cero.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(1)
+*/
+void Dish::removeOrder() {
+    if (totalOrders > 0) totalOrders--;
+}
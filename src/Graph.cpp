@@ -1,4 +1,7 @@
 #include "Graph.hpp"
+#include "Hilos.hpp"
+#include "Bits.hpp"
+#include <atomic>
 #include <iostream>
 
 /*
@@ -15,8 +18,8 @@ NodoAdyacencia::NodoAdyacencia(int destino, int pesoInicial)
 
 /*
     funcion: ~NodoAdyacencia (Destructor)
-    Descripcion: Destructor del nodo. La liberación de la cadena se hace
-                 desde el Vertice para evitar eliminación recursiva profunda.
+    Descripcion: Destructor del nodo. La memoria de la cadena pertenece a la arena
+                 del grafo, que la libera completa al reiniciarse.
     Complejidad: O(1)
 */
 NodoAdyacencia::~NodoAdyacencia() {
@@ -27,7 +30,7 @@ NodoAdyacencia::~NodoAdyacencia() {
     Descripcion: Inicializa un vértice vacío.
     Complejidad: O(1)
 */
-Vertice::Vertice() : nombre(""), tipo(' '), cabezaLista(nullptr) {
+Vertice::Vertice() : nombre(""), tipo(' '), cabezaLista(nullptr), grado(0), pesoTotal(0) {
 }
 
 /*
@@ -39,13 +42,13 @@ Vertice::Vertice() : nombre(""), tipo(' '), cabezaLista(nullptr) {
     Complejidad: O(1)
 */
 Vertice::Vertice(const String& nom, char t)
-    : nombre(nom), tipo(t), cabezaLista(nullptr) {
+    : nombre(nom), tipo(t), cabezaLista(nullptr), grado(0), pesoTotal(0) {
 }
 
 /*
     funcion: ~Vertice (Destructor)
-    Descripcion: Libera la memoria de la lista de adyacencias.
-    Complejidad: O(k) donde k es el número de aristas del vértice
+    Descripcion: Suelta la lista de adyacencias. Los nodos pertenecen a la arena del grafo.
+    Complejidad: O(1)
 */
 Vertice::~Vertice() {
     limpiarLista();
@@ -53,40 +56,159 @@ Vertice::~Vertice() {
 
 /*
     funcion: limpiarLista
-    Descripcion: Libera iterativamente todos los nodos de la lista enlazada.
-                 Evita recursión profunda que podría causar stack overflow.
-    Complejidad: O(k) donde k es el número de aristas
+    Descripcion: Desconecta la lista de adyacencias del vértice. Los nodos viven en la
+                 arena del grafo y se liberan todos juntos cuando el grafo la reinicia,
+                 así que no hay que recorrer la lista.
+    Complejidad: O(1)
 */
 void Vertice::limpiarLista() {
-    NodoAdyacencia* actual = cabezaLista;
-    while (actual != nullptr) {
-        NodoAdyacencia* siguiente = actual->siguiente;
-        delete actual;
-        actual = siguiente;
-    }
     cabezaLista = nullptr;
 }
 
+// ============================================================================
+// IMPLEMENTACIÓN DE GrafoCSR
+// ============================================================================
+
+/*
+    funcion: GrafoCSR (Constructor)
+    Descripcion: Inicializa una forma CSR vacía, sin memoria reservada.
+    Complejidad: O(1)
+*/
+GrafoCSR::GrafoCSR()
+    : offsets(nullptr), vecinos(nullptr), pesos(nullptr),
+      numNodos(0), numAristas(0), capacidadNodos(0), capacidadAristas(0) {
+}
+
+/*
+    funcion: ~GrafoCSR (Destructor)
+    Descripcion: Libera los arreglos de la forma CSR.
+    Complejidad: O(1)
+*/
+GrafoCSR::~GrafoCSR() {
+    delete[] offsets;
+    delete[] vecinos;
+    delete[] pesos;
+}
+
+/*
+    funcion: reservar
+    Descripcion: Asegura capacidad para 'nodos' vértices y 'aristas' aristas dirigidas.
+                 Sólo reserva memoria nueva si la actual no alcanza, así que reconstruir
+                 el CSR del mismo grafo no vuelve a pedir memoria.
+    Parametros:
+        - nodos: Número de vértices
+        - aristas: Número de aristas dirigidas
+    Complejidad: O(1) amortizado
+*/
+void GrafoCSR::reservar(int nodos, int aristas) {
+    if (nodos + 1 > capacidadNodos) {
+        delete[] offsets;
+        capacidadNodos = nodos + 1;
+        offsets = new int[capacidadNodos];
+    }
+    if (aristas > capacidadAristas) {
+        delete[] vecinos;
+        delete[] pesos;
+        capacidadAristas = aristas;
+        vecinos = new int[capacidadAristas];
+        pesos = new int[capacidadAristas];
+    }
+    numNodos = nodos;
+    numAristas = aristas;
+}
+
+/*
+    funcion: grado
+    Descripcion: Número de vecinos de un nodo.
+    Parametros:
+        - nodo: ID del nodo
+    Return: Grado del nodo
+    Complejidad: O(1)
+*/
+int GrafoCSR::grado(int nodo) const {
+    return offsets[nodo + 1] - offsets[nodo];
+}
+
 // ============================================================================
 // IMPLEMENTACIÓN DE Graph
 // ============================================================================
 
 /*
     funcion: Graph (Constructor)
-    Descripcion: Inicializa el grafo con capacidad para MAX_NODOS vértices.
-    Complejidad: O(MAX_NODOS)
+    Descripcion: Inicializa un grafo vacío. Los vértices no se reservan hasta que se
+                 crea el primer nodo.
+    Complejidad: O(1)
 */
-Graph::Graph() : numNodos(0) {
-    grafo = new Vertice[MAX_NODOS];
+Graph::Graph() : grafo(nullptr), numNodos(0), capacidadNodos(0), numAristasDirigidas(0),
+                 pesoTotalDirigido(0), numPlatillos(0), numRestaurantes(0),
+                 platilloMasConectado(-1), restauranteMasConectado(-1),
+                 csrValido(false), indiceIds(nullptr), indiceHashes(nullptr), capacidadIndice(0),
+                 indiceAristasLlaves(nullptr), indiceAristasNodos(nullptr), capacidadIndiceAristas(0),
+                 pilaNodos(nullptr), pilaCursores(nullptr), visitados(nullptr),
+                 marcasRecorrido(nullptr), epocaRecorrido(0), capacidadRecorrido(0),
+                 padreComponente(nullptr), tamanoComponente(nullptr), numComponentes(0), raizMasGrande(-1),
+                 platillosAislados(0), restaurantesAislados(0) {
+    for (int i = 0; i < RANGOS_TAMANO; ++i) {
+        componentesPorRango[i] = 0;
+    }
 }
 
 /*
     funcion: ~Graph (Destructor)
-    Descripcion: Libera toda la memoria del grafo.
-    Complejidad: O(V + E)
+    Descripcion: Libera toda la memoria del grafo. Las aristas se liberan con la arena.
+    Complejidad: O(V)
 */
 Graph::~Graph() {
     delete[] grafo;
+    delete[] indiceIds;
+    delete[] indiceHashes;
+    delete[] indiceAristasLlaves;
+    delete[] indiceAristasNodos;
+    delete[] pilaNodos;
+    delete[] pilaCursores;
+    delete[] visitados;
+    delete[] marcasRecorrido;
+    delete[] padreComponente;
+    delete[] tamanoComponente;
+}
+
+/*
+    funcion: crecerVertices
+    Descripcion: Cambia el arreglo de vértices por uno con capacidad para al menos
+                 'minimo' vértices (al menos el doble de la actual) y copia los existentes.
+                 No hay reserva previa: OrderManager crea los vértices mientras lee las
+                 órdenes, antes de saber cuántos nombres distintos hay, así que duplicar
+                 deja el costo en O(1) amortizado por vértice.
+    Parametros:
+        - minimo: Capacidad mínima requerida
+    Complejidad: O(V + nueva capacidad)
+*/
+void Graph::crecerVertices(int minimo) {
+    int nuevaCapacidad = (capacidadNodos == 0) ? 64 : capacidadNodos * 2;
+    if (nuevaCapacidad < minimo) {
+        nuevaCapacidad = minimo;
+    }
+    
+    Vertice* nuevos = new Vertice[nuevaCapacidad];
+    int* nuevosPadres = new int[nuevaCapacidad];
+    int* nuevosTamanos = new int[nuevaCapacidad];
+    for (int i = 0; i < numNodos; ++i) {
+        nuevos[i].nombre = grafo[i].nombre;
+        nuevos[i].tipo = grafo[i].tipo;
+        nuevos[i].cabezaLista = grafo[i].cabezaLista;
+        nuevos[i].grado = grafo[i].grado;
+        nuevos[i].pesoTotal = grafo[i].pesoTotal;
+        nuevosPadres[i] = padreComponente[i];
+        nuevosTamanos[i] = tamanoComponente[i];
+    }
+    
+    delete[] grafo;
+    delete[] padreComponente;
+    delete[] tamanoComponente;
+    grafo = nuevos;
+    padreComponente = nuevosPadres;
+    tamanoComponente = nuevosTamanos;
+    capacidadNodos = nuevaCapacidad;
 }
 
 /*
@@ -97,52 +219,264 @@ Graph::~Graph() {
         - nombre: Nombre del vértice
         - tipo: 'P' para Platillo, 'R' para Restaurante
     Return: ID numérico del nodo
-    Complejidad: O(n) búsqueda lineal
+    Complejidad: O(1) esperado (índice hash)
 */
 int Graph::obtenerOcrearNodo(const String& nombre, char tipo) {
     // Buscar si ya existe
-    for (int i = 0; i < numNodos; ++i) {
-        if (grafo[i].nombre == nombre && grafo[i].tipo == tipo) {
-            return i;
-        }
+    int existente = buscarEnIndice(nombre, tipo);
+    if (existente >= 0) {
+        return existente;
     }
     
-    // No existe, crear nuevo nodo
-    if (numNodos >= MAX_NODOS) {
-        std::cerr << "Error: Capacidad máxima del grafo alcanzada." << std::endl;
-        return -1;
+    // No existe, crear nuevo nodo (creciendo el arreglo si ya está lleno)
+    if (numNodos >= capacidadNodos) {
+        crecerVertices(numNodos + 1);
     }
     
     grafo[numNodos].nombre = nombre;
     grafo[numNodos].tipo = tipo;
     grafo[numNodos].cabezaLista = nullptr;
+    grafo[numNodos].grado = 0;
+    grafo[numNodos].pesoTotal = 0;
+    csrValido = false;
+    insertarEnIndice(numNodos);
+    
+    // Cada nodo nuevo empieza como una componente aislada
+    padreComponente[numNodos] = numNodos;
+    tamanoComponente[numNodos] = 1;
+    numComponentes++;
+    componentesPorRango[0]++;
+    if (raizMasGrande == -1) raizMasGrande = numNodos;
+    if (tipo == 'P') {
+        platillosAislados++;
+        numPlatillos++;
+    } else {
+        restaurantesAislados++;
+        numRestaurantes++;
+    }
+    actualizarMasConectado(numNodos);
     
     return numNodos++;
 }
 
+/*
+    funcion: hashNombre
+    Descripcion: Hash FNV-1a del nombre combinado con el tipo del nodo, de modo que un
+                 platillo y un restaurante con el mismo nombre caigan en casillas distintas.
+    Parametros:
+        - nombre: Nombre del vértice
+        - tipo: 'P' o 'R'
+    Return: Hash de 32 bits
+    Complejidad: O(L), donde L es la longitud del nombre
+*/
+unsigned int Graph::hashNombre(const String& nombre, char tipo) {
+    unsigned int hash = 2166136261u;
+    const char* texto = nombre.c_str();
+    for (size_t i = 0; i < nombre.length(); ++i) {
+        hash ^= static_cast<unsigned char>(texto[i]);
+        hash *= 16777619u;
+    }
+    hash ^= static_cast<unsigned char>(tipo);
+    hash *= 16777619u;
+    return hash;
+}
+
+/*
+    funcion: buscarEnIndice
+    Descripcion: Busca en el índice hash el ID del nodo con ese nombre y tipo.
+    Parametros:
+        - nombre: Nombre del vértice
+        - tipo: 'P' o 'R'
+    Return: ID del nodo, -1 si no existe
+    Complejidad: O(1) esperado
+*/
+int Graph::buscarEnIndice(const String& nombre, char tipo) const {
+    if (capacidadIndice == 0) return -1;
+    
+    const unsigned int hash = hashNombre(nombre, tipo);
+    const int mascara = capacidadIndice - 1;
+    int casilla = static_cast<int>(hash & static_cast<unsigned int>(mascara));
+    
+    while (indiceIds[casilla] != -1) {
+        const int id = indiceIds[casilla];
+        if (indiceHashes[casilla] == hash && grafo[id].tipo == tipo && grafo[id].nombre == nombre) {
+            return id;
+        }
+        casilla = (casilla + 1) & mascara;
+    }
+    return -1;
+}
+
+/*
+    funcion: insertarEnIndice
+    Descripcion: Registra un nodo recién creado en el índice hash. La tabla crece al
+                 doble cuando pasaría del 50% de ocupación.
+    Parametros:
+        - id: ID del nodo (su nombre y tipo ya deben estar asignados)
+    Complejidad: O(1) amortizado
+*/
+void Graph::insertarEnIndice(int id) {
+    if (2 * (numNodos + 1) > capacidadIndice) {
+        crecerIndice();
+    }
+    
+    const unsigned int hash = hashNombre(grafo[id].nombre, grafo[id].tipo);
+    const int mascara = capacidadIndice - 1;
+    int casilla = static_cast<int>(hash & static_cast<unsigned int>(mascara));
+    while (indiceIds[casilla] != -1) {
+        casilla = (casilla + 1) & mascara;
+    }
+    indiceIds[casilla] = id;
+    indiceHashes[casilla] = hash;
+}
+
+/*
+    funcion: crecerIndice
+    Descripcion: Duplica la tabla hash y reubica los nodos existentes usando
+                 los hashes guardados (no vuelve a leer los nombres).
+    Complejidad: O(capacidad)
+*/
+void Graph::crecerIndice() {
+    const int capacidadAnterior = capacidadIndice;
+    int* idsAnteriores = indiceIds;
+    unsigned int* hashesAnteriores = indiceHashes;
+    
+    capacidadIndice = (capacidadAnterior == 0) ? 64 : capacidadAnterior * 2;
+    indiceIds = new int[capacidadIndice];
+    indiceHashes = new unsigned int[capacidadIndice];
+    for (int i = 0; i < capacidadIndice; ++i) {
+        indiceIds[i] = -1;
+    }
+    
+    const int mascara = capacidadIndice - 1;
+    for (int i = 0; i < capacidadAnterior; ++i) {
+        if (idsAnteriores[i] == -1) continue;
+        int casilla = static_cast<int>(hashesAnteriores[i] & static_cast<unsigned int>(mascara));
+        while (indiceIds[casilla] != -1) {
+            casilla = (casilla + 1) & mascara;
+        }
+        indiceIds[casilla] = idsAnteriores[i];
+        indiceHashes[casilla] = hashesAnteriores[i];
+    }
+    
+    delete[] idsAnteriores;
+    delete[] hashesAnteriores;
+}
+
 /*
     funcion: buscarArista
-    Descripcion: Recorre la lista enlazada del nodo origen buscando
-                 una conexión al nodo destino.
+    Descripcion: Busca en el índice de aristas la conexión del nodo origen
+                 al nodo destino.
     Parametros:
         - idOrigen: ID del nodo origen
         - idDestino: ID del nodo destino
     Return: Puntero al NodoAdyacencia si existe, nullptr si no
-    Complejidad: O(k) donde k es el grado del nodo origen
+    Complejidad: O(1) esperado
 */
 NodoAdyacencia* Graph::buscarArista(int idOrigen, int idDestino) const {
     if (idOrigen < 0 || idOrigen >= numNodos) return nullptr;
+    if (capacidadIndiceAristas == 0) return nullptr;
     
-    NodoAdyacencia* actual = grafo[idOrigen].cabezaLista;
-    while (actual != nullptr) {
-        if (actual->idDestino == idDestino) {
-            return actual;
+    const unsigned long long llave = llaveArista(idOrigen, idDestino);
+    const int mascara = capacidadIndiceAristas - 1;
+    int casilla = static_cast<int>(hashArista(llave) & static_cast<unsigned int>(mascara));
+    
+    while (indiceAristasNodos[casilla] != nullptr) {
+        if (indiceAristasLlaves[casilla] == llave) {
+            return indiceAristasNodos[casilla];
         }
-        actual = actual->siguiente;
+        casilla = (casilla + 1) & mascara;
     }
     return nullptr;
 }
 
+/*
+    funcion: llaveArista
+    Descripcion: Empaca el par (origen, destino) en una sola llave de 64 bits.
+    Parametros:
+        - idOrigen: ID del nodo origen
+        - idDestino: ID del nodo destino
+    Return: Llave de la arista
+    Complejidad: O(1)
+*/
+unsigned long long Graph::llaveArista(int idOrigen, int idDestino) {
+    return (static_cast<unsigned long long>(static_cast<unsigned int>(idOrigen)) << 32)
+           | static_cast<unsigned int>(idDestino);
+}
+
+/*
+    funcion: hashArista
+    Descripcion: Mezcla los bits de la llave (finalizador de MurmurHash3) para que IDs
+                 consecutivos no caigan en casillas consecutivas.
+    Parametros:
+        - llave: Llave empacada de la arista
+    Return: Hash de 32 bits
+    Complejidad: O(1)
+*/
+unsigned int Graph::hashArista(unsigned long long llave) {
+    llave ^= llave >> 33;
+    llave *= 0xff51afd7ed558ccdULL;
+    llave ^= llave >> 33;
+    llave *= 0xc4ceb9fe1a85ec53ULL;
+    llave ^= llave >> 33;
+    return static_cast<unsigned int>(llave);
+}
+
+/*
+    funcion: insertarEnIndiceAristas
+    Descripcion: Registra una arista nueva en el índice. La tabla crece al doble
+                 cuando pasaría del 50% de ocupación.
+    Parametros:
+        - llave: Llave empacada de la arista
+        - arista: Nodo de adyacencia de la arista
+    Complejidad: O(1) amortizado
+*/
+void Graph::insertarEnIndiceAristas(unsigned long long llave, NodoAdyacencia* arista) {
+    if (2 * (numAristasDirigidas + 1) > capacidadIndiceAristas) {
+        crecerIndiceAristas();
+    }
+    
+    const int mascara = capacidadIndiceAristas - 1;
+    int casilla = static_cast<int>(hashArista(llave) & static_cast<unsigned int>(mascara));
+    while (indiceAristasNodos[casilla] != nullptr) {
+        casilla = (casilla + 1) & mascara;
+    }
+    indiceAristasLlaves[casilla] = llave;
+    indiceAristasNodos[casilla] = arista;
+}
+
+/*
+    funcion: crecerIndiceAristas
+    Descripcion: Duplica la tabla de aristas y reubica las existentes.
+    Complejidad: O(capacidad)
+*/
+void Graph::crecerIndiceAristas() {
+    const int capacidadAnterior = capacidadIndiceAristas;
+    unsigned long long* llavesAnteriores = indiceAristasLlaves;
+    NodoAdyacencia** nodosAnteriores = indiceAristasNodos;
+    
+    capacidadIndiceAristas = (capacidadAnterior == 0) ? 256 : capacidadAnterior * 2;
+    indiceAristasLlaves = new unsigned long long[capacidadIndiceAristas];
+    indiceAristasNodos = new NodoAdyacencia*[capacidadIndiceAristas];
+    for (int i = 0; i < capacidadIndiceAristas; ++i) {
+        indiceAristasNodos[i] = nullptr;
+    }
+    
+    const int mascara = capacidadIndiceAristas - 1;
+    for (int i = 0; i < capacidadAnterior; ++i) {
+        if (nodosAnteriores[i] == nullptr) continue;
+        int casilla = static_cast<int>(hashArista(llavesAnteriores[i]) & static_cast<unsigned int>(mascara));
+        while (indiceAristasNodos[casilla] != nullptr) {
+            casilla = (casilla + 1) & mascara;
+        }
+        indiceAristasLlaves[casilla] = llavesAnteriores[i];
+        indiceAristasNodos[casilla] = nodosAnteriores[i];
+    }
+    
+    delete[] llavesAnteriores;
+    delete[] nodosAnteriores;
+}
+
 /*
     funcion: agregarAristaUnidireccional
     Descripcion: Función auxiliar que agrega una arista en UNA sola dirección.
@@ -150,7 +484,7 @@ NodoAdyacencia* Graph::buscarArista(int idOrigen, int idDestino) const {
     Parametros:
         - idOrigen: ID del nodo origen
         - idDestino: ID del nodo destino
-    Complejidad: O(k) búsqueda + O(1) inserción
+    Complejidad: O(1) esperado (búsqueda en el índice de aristas + inserción al inicio)
 */
 void Graph::agregarAristaUnidireccional(int idOrigen, int idDestino) {
     // Buscar si ya existe la arista
@@ -161,9 +495,50 @@ void Graph::agregarAristaUnidireccional(int idOrigen, int idDestino) {
         existente->peso++;
     } else {
         // CASO 2: No existe, crear nuevo nodo
-        NodoAdyacencia* nuevo = new NodoAdyacencia(idDestino, 1);
+        NodoAdyacencia* nuevo = arenaAristas.create<NodoAdyacencia>(idDestino, 1);
         nuevo->siguiente = grafo[idOrigen].cabezaLista;
         grafo[idOrigen].cabezaLista = nuevo;
+        insertarEnIndiceAristas(llaveArista(idOrigen, idDestino), nuevo);
+        numAristasDirigidas++;
+        grafo[idOrigen].grado++;
+    }
+    grafo[idOrigen].pesoTotal++;
+    pesoTotalDirigido++;
+    actualizarMasConectado(idOrigen);
+    csrValido = false;
+}
+
+/*
+    funcion: estaMasConectado
+    Descripcion: Criterio del "más conectado". Platillos: más restaurantes y, en empate,
+                 más pedidos. Restaurantes: más platillos. En empate total gana el menor ID
+                 (el primero que se creó).
+    Parametros:
+        - idA, idB: Nodos del mismo tipo a comparar
+    Return: true si 'idA' está más conectado que 'idB'
+    Complejidad: O(1)
+*/
+bool Graph::estaMasConectado(int idA, int idB) const {
+    if (grafo[idA].grado != grafo[idB].grado) return grafo[idA].grado > grafo[idB].grado;
+    if (grafo[idA].tipo == 'P' && grafo[idA].pesoTotal != grafo[idB].pesoTotal) {
+        return grafo[idA].pesoTotal > grafo[idB].pesoTotal;
+    }
+    return idA < idB;
+}
+
+/*
+    funcion: actualizarMasConectado
+    Descripcion: Revisa si un nodo cuyo grado o peso acaba de crecer supera al más
+                 conectado de su tipo. Como los contadores sólo aumentan, el actual
+                 más conectado nunca pierde su lugar salvo frente al nodo que cambió.
+    Parametros:
+        - id: Nodo que acaba de cambiar
+    Complejidad: O(1)
+*/
+void Graph::actualizarMasConectado(int id) {
+    int& mejor = (grafo[id].tipo == 'P') ? platilloMasConectado : restauranteMasConectado;
+    if (mejor == -1 || estaMasConectado(id, mejor)) {
+        mejor = id;
     }
 }
 
@@ -179,7 +554,7 @@ void Graph::agregarAristaUnidireccional(int idOrigen, int idDestino) {
     Parametros:
         - idOrigen: ID del nodo origen (típicamente un Platillo)
         - idDestino: ID del nodo destino (típicamente un Restaurante)
-    Complejidad: O(k1 + k2) búsqueda en ambas listas + O(1) inserción
+    Complejidad: O(1) esperado
 */
 void Graph::agregarArista(int idOrigen, int idDestino) {
     if (idOrigen < 0 || idOrigen >= numNodos || 
@@ -190,6 +565,140 @@ void Graph::agregarArista(int idOrigen, int idDestino) {
     // Agregar arista en ambas direcciones (grafo bidireccional/no dirigido)
     agregarAristaUnidireccional(idOrigen, idDestino);  // origen -> destino
     agregarAristaUnidireccional(idDestino, idOrigen);  // destino -> origen
+    unirComponentes(idOrigen, idDestino);
+}
+
+/*
+    funcion: rangoDeTamano
+    Descripcion: Rango del histograma de componentes al que pertenece un tamaño:
+                 k tal que 2^k <= tamano < 2^(k+1).
+    Parametros:
+        - tamano: Número de nodos de una componente (>= 1)
+    Return: Índice del rango
+    Complejidad: O(log tamano)
+*/
+int Graph::rangoDeTamano(int tamano) {
+    int rango = 0;
+    while (tamano > 1) {
+        tamano >>= 1;
+        rango++;
+    }
+    return rango;
+}
+
+/*
+    funcion: buscarComponente
+    Descripcion: Devuelve la raíz (representante) de la componente de un nodo.
+                 Aplica compresión de caminos por mitades: cada nodo visitado pasa a
+                 apuntar a su abuelo, lo que aplana el árbol para consultas futuras.
+    Parametros:
+        - id: ID del nodo
+    Return: ID de la raíz, -1 si el nodo no existe
+    Complejidad: O(α(V)) amortizado
+*/
+int Graph::buscarComponente(int id) const {
+    if (id < 0 || id >= numNodos) return -1;
+    
+    while (padreComponente[id] != id) {
+        padreComponente[id] = padreComponente[padreComponente[id]];
+        id = padreComponente[id];
+    }
+    return id;
+}
+
+/*
+    funcion: unirComponentes
+    Descripcion: Une las componentes de dos nodos (unión por tamaño: la pequeña cuelga
+                 de la grande) y actualiza los contadores de componentes.
+    Parametros:
+        - idA, idB: Nodos que acaban de conectarse
+    Complejidad: O(α(V)) amortizado
+*/
+void Graph::unirComponentes(int idA, int idB) {
+    int raizA = buscarComponente(idA);
+    int raizB = buscarComponente(idB);
+    if (raizA == raizB) return;
+    
+    if (tamanoComponente[raizA] < tamanoComponente[raizB]) {
+        const int temporal = raizA;
+        raizA = raizB;
+        raizB = temporal;
+    }
+    
+    const int tamanoA = tamanoComponente[raizA];
+    const int tamanoB = tamanoComponente[raizB];
+    
+    // Un nodo que estaba solo deja de estar aislado
+    if (tamanoA == 1) {
+        if (grafo[raizA].tipo == 'P') platillosAislados--; else restaurantesAislados--;
+    }
+    if (tamanoB == 1) {
+        if (grafo[raizB].tipo == 'P') platillosAislados--; else restaurantesAislados--;
+    }
+    
+    componentesPorRango[rangoDeTamano(tamanoA)]--;
+    componentesPorRango[rangoDeTamano(tamanoB)]--;
+    componentesPorRango[rangoDeTamano(tamanoA + tamanoB)]++;
+    
+    padreComponente[raizB] = raizA;
+    tamanoComponente[raizA] = tamanoA + tamanoB;
+    numComponentes--;
+    
+    if (tamanoComponente[raizA] >= tamanoComponente[buscarComponente(raizMasGrande)]) {
+        raizMasGrande = raizA;
+    }
+}
+
+/*
+    funcion: construirCSR
+    Descripcion: Congela el grafo: copia las listas de adyacencia a la forma CSR.
+                 Se llama al terminar de construir el grafo; si después se agregan nodos
+                 o aristas, la copia se vuelve a generar en el siguiente recorrido.
+    Complejidad: O(V + E)
+*/
+void Graph::construirCSR() {
+    llenarCSR(csr);
+    csrValido = true;
+}
+
+/*
+    funcion: obtenerCSR
+    Descripcion: Devuelve la forma CSR del grafo, reconstruyéndola si quedó desactualizada.
+    Return: Referencia a la forma CSR vigente
+    Complejidad: O(1) si está vigente, O(V + E) si hay que reconstruirla
+*/
+const GrafoCSR& Graph::obtenerCSR() const {
+    if (!csrValido) {
+        llenarCSR(csr);
+        csrValido = true;
+    }
+    return csr;
+}
+
+/*
+    funcion: llenarCSR
+    Descripcion: Copia las listas enlazadas a un GrafoCSR. Los vecinos de cada nodo
+                 conservan el orden de su lista, así que los recorridos dan el mismo
+                 resultado con ambas representaciones.
+    Parametros:
+        - destino: Forma CSR a llenar
+    Complejidad: O(V + E)
+*/
+void Graph::llenarCSR(GrafoCSR& destino) const {
+    destino.reservar(numNodos, numAristasDirigidas);
+    
+    int posicion = 0;
+    for (int i = 0; i < numNodos; ++i) {
+        destino.offsets[i] = posicion;
+        NodoAdyacencia* vecino = grafo[i].cabezaLista;
+        while (vecino != nullptr) {
+            destino.vecinos[posicion] = vecino->idDestino;
+            destino.pesos[posicion] = vecino->peso;
+            posicion++;
+            vecino = vecino->siguiente;
+        }
+    }
+    destino.offsets[numNodos] = posicion;
 }
 
 /*
@@ -202,7 +711,7 @@ void Graph::agregarArista(int idOrigen, int idDestino) {
     2. Meter nodo inicial a la cola
     3. Mientras la cola no esté vacía:
        a. Sacar el primer elemento
-       b. Recorrer sus vecinos (lista enlazada)
+       b. Recorrer sus vecinos (rango contiguo del CSR)
        c. Si el vecino no fue visitado, agregarlo a la cola
     
     Parametros:
@@ -215,6 +724,8 @@ void Graph::ejecutarBFS(const int nodoInicio) const {
         return;
     }
     
+    const GrafoCSR& g = obtenerCSR();
+    
     // Arreglo de visitados
     bool* visitado = new bool[numNodos];
     for (int i = 0; i < numNodos; ++i) {
@@ -249,15 +760,14 @@ void Graph::ejecutarBFS(const int nodoInicio) const {
             if (grafo[nodoActual].tipo == 'R') std::cout << "(R)";
             else std::cout << "(P)";
             
-            // Recorrer lista de adyacencias
-            NodoAdyacencia* vecino = grafo[nodoActual].cabezaLista;
-            while (vecino != nullptr) {
-                if (!visitado[vecino->idDestino]) {
-                    visitado[vecino->idDestino] = true;
-                    cola[final_cola++] = vecino->idDestino;
+            // Recorrer los vecinos en el CSR
+            for (int k = g.offsets[nodoActual]; k < g.offsets[nodoActual + 1]; ++k) {
+                int destino = g.vecinos[k];
+                if (!visitado[destino]) {
+                    visitado[destino] = true;
+                    cola[final_cola++] = destino;
                     nodosEnSiguienteNivel++;
                 }
-                vecino = vecino->siguiente;
             }
             
             if (n < nodosEnNivelActual - 1) std::cout << ", ";
@@ -276,6 +786,254 @@ void Graph::ejecutarBFS(const int nodoInicio) const {
     delete[] cola;
 }
 
+/*
+    funcion: calcularNivelesBFS
+    Descripcion: BFS paralelo de dirección optimizada (Beamer et al.). Calcula la distancia
+                 (nivel) de cada nodo al nodo inicial sin imprimir nada.
+                 Cada nivel se reparte entre hilos y se elige una de dos estrategias:
+                 - Arriba-abajo: cada hilo toma una parte de la frontera y reclama a los vecinos
+                   no visitados con un fetch_or atómico sobre el bitset de visitados.
+                 - Abajo-arriba: cada hilo toma un rango de nodos sin visitar y busca si alguno
+                   de sus vecinos está en la frontera; se detiene en el primero que encuentra.
+                 Se cambia a abajo-arriba cuando la frontera toca muchas aristas y se regresa
+                 cuando la frontera vuelve a ser pequeña. Los niveles no dependen del número
+                 de hilos; sólo el orden interno de cada frontera puede variar.
+    Parametros:
+        - nodoInicio: ID del nodo inicial
+        - distancias: Arreglo de numNodos enteros; recibe el nivel de cada nodo o -1 si no es alcanzable
+        - numHilos: Hilos a usar; 0 usa todos los núcleos
+    Return: Número de niveles (distancia máxima + 1), -1 si el nodo inicial es inválido
+    Complejidad: O(V + E) de trabajo total, repartido entre los hilos
+*/
+int Graph::calcularNivelesBFS(int nodoInicio, int* distancias, int numHilos) const {
+    return calcularNivelesBFS(obtenerCSR(), nodoInicio, distancias, numHilos);
+}
+
+/*
+    funcion: calcularNivelesBFS (sobre un CSR dado)
+    Descripcion: Igual que la versión anterior, pero recorre el CSR que se le pasa en lugar
+                 del CSR del grafo. Sirve para subgrafos con los mismos IDs de nodo, como el
+                 grafo de un rango de fechas (ver LineaTiempoGrafo::construirVentana).
+    Parametros:
+        - g: CSR con los mismos numNodos que el grafo
+        - nodoInicio: ID del nodo inicial
+        - distancias: Arreglo de numNodos enteros; recibe el nivel de cada nodo o -1 si no es alcanzable
+        - numHilos: Hilos a usar; 0 usa todos los núcleos
+    Return: Número de niveles (distancia máxima + 1), -1 si el nodo inicial es inválido
+    Complejidad: O(V + E) de trabajo total, repartido entre los hilos
+*/
+int Graph::calcularNivelesBFS(const GrafoCSR& g, int nodoInicio, int* distancias, int numHilos) const {
+    if (nodoInicio < 0 || nodoInicio >= numNodos || g.numNodos != numNodos) return -1;
+    
+    typedef unsigned long long Palabra;
+    const int n = numNodos;
+    const int palabras = (n + 63) / 64;
+    const int hilos = numeroDeHilos(numHilos);
+    const int TAM_BLOQUE = 256;          // Descubrimientos que un hilo junta antes de publicarlos
+    const int MINIMO_POR_HILO = 2048;    // Trabajo mínimo que justifica otro hilo
+    
+    std::atomic<Palabra>* visitadoBits = new std::atomic<Palabra>[palabras];
+    std::atomic<Palabra>* fronteraBits = new std::atomic<Palabra>[palabras];
+    int* frontera = new int[n];
+    int* siguiente = new int[n];
+    for (int i = 0; i < palabras; ++i) {
+        visitadoBits[i].store(0, std::memory_order_relaxed);
+    }
+    for (int i = 0; i < n; ++i) {
+        distancias[i] = -1;
+    }
+    
+    distancias[nodoInicio] = 0;
+    visitadoBits[nodoInicio >> 6].store(1ULL << (nodoInicio & 63), std::memory_order_relaxed);
+    frontera[0] = nodoInicio;
+    int tamFrontera = 1;
+    long long aristasFrontera = g.grado(nodoInicio);
+    long long aristasSinVisitar = g.numAristas - aristasFrontera;
+    bool abajoArriba = false;
+    int nivel = 0;
+    
+    while (tamFrontera > 0) {
+        // Elegir la dirección del siguiente paso
+        if (!abajoArriba && aristasFrontera > aristasSinVisitar / ALFA_BFS) {
+            abajoArriba = true;
+        } else if (abajoArriba && tamFrontera < n / BETA_BFS) {
+            abajoArriba = false;
+        }
+        
+        std::atomic<int> tamSiguiente(0);
+        std::atomic<long long> aristasSiguiente(0);
+        
+        if (abajoArriba) {
+            // Marcar la frontera actual en su bitset
+            for (int i = 0; i < palabras; ++i) {
+                fronteraBits[i].store(0, std::memory_order_relaxed);
+            }
+            const int hilosMarca = hilosParaTrabajo(hilos, tamFrontera, MINIMO_POR_HILO);
+            ejecutarEnHilos(hilosMarca, [&](int h) {
+                const int inicio = static_cast<int>(static_cast<long long>(tamFrontera) * h / hilosMarca);
+                const int fin = static_cast<int>(static_cast<long long>(tamFrontera) * (h + 1) / hilosMarca);
+                for (int i = inicio; i < fin; ++i) {
+                    const int u = frontera[i];
+                    fronteraBits[u >> 6].fetch_or(1ULL << (u & 63), std::memory_order_relaxed);
+                }
+            });
+            
+            // Cada hilo revisa un rango de nodos sin visitar (rangos alineados a 64)
+            const int hilosNivel = hilosParaTrabajo(hilos, n, MINIMO_POR_HILO);
+            ejecutarEnHilos(hilosNivel, [&](int h) {
+                const int palabraInicio = static_cast<int>(static_cast<long long>(palabras) * h / hilosNivel);
+                const int palabraFin = static_cast<int>(static_cast<long long>(palabras) * (h + 1) / hilosNivel);
+                int bloque[TAM_BLOQUE];
+                int enBloque = 0;
+                long long aristasLocal = 0;
+                
+                for (int w = palabraInicio; w < palabraFin; ++w) {
+                    Palabra libres = ~visitadoBits[w].load(std::memory_order_relaxed);
+                    Palabra nuevos = 0;
+                    while (libres != 0) {
+                        const int bit = bitMasBajo(libres);
+                        libres &= libres - 1;
+                        const int v = (w << 6) + bit;
+                        if (v >= n) break;
+                        
+                        for (int k = g.offsets[v]; k < g.offsets[v + 1]; ++k) {
+                            const int u = g.vecinos[k];
+                            if (fronteraBits[u >> 6].load(std::memory_order_relaxed) & (1ULL << (u & 63))) {
+                                nuevos |= 1ULL << bit;
+                                distancias[v] = nivel + 1;
+                                aristasLocal += g.grado(v);
+                                bloque[enBloque++] = v;
+                                if (enBloque == TAM_BLOQUE) {
+                                    const int pos = tamSiguiente.fetch_add(enBloque);
+                                    for (int j = 0; j < enBloque; ++j) siguiente[pos + j] = bloque[j];
+                                    enBloque = 0;
+                                }
+                                break;
+                            }
+                        }
+                    }
+                    // La palabra sólo la escribe este hilo durante el paso
+                    if (nuevos != 0) visitadoBits[w].fetch_or(nuevos, std::memory_order_relaxed);
+                }
+                
+                const int pos = tamSiguiente.fetch_add(enBloque);
+                for (int j = 0; j < enBloque; ++j) siguiente[pos + j] = bloque[j];
+                aristasSiguiente.fetch_add(aristasLocal);
+            });
+        } else {
+            // Cada hilo expande una parte de la frontera
+            const int hilosNivel = hilosParaTrabajo(hilos, aristasFrontera, MINIMO_POR_HILO);
+            ejecutarEnHilos(hilosNivel, [&](int h) {
+                const int inicio = static_cast<int>(static_cast<long long>(tamFrontera) * h / hilosNivel);
+                const int fin = static_cast<int>(static_cast<long long>(tamFrontera) * (h + 1) / hilosNivel);
+                int bloque[TAM_BLOQUE];
+                int enBloque = 0;
+                long long aristasLocal = 0;
+                
+                for (int i = inicio; i < fin; ++i) {
+                    const int u = frontera[i];
+                    for (int k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+                        const int v = g.vecinos[k];
+                        const Palabra mascara = 1ULL << (v & 63);
+                        if (visitadoBits[v >> 6].load(std::memory_order_relaxed) & mascara) continue;
+                        // Sólo el hilo que pone el bit agrega el nodo
+                        if (visitadoBits[v >> 6].fetch_or(mascara, std::memory_order_relaxed) & mascara) continue;
+                        
+                        distancias[v] = nivel + 1;
+                        aristasLocal += g.grado(v);
+                        bloque[enBloque++] = v;
+                        if (enBloque == TAM_BLOQUE) {
+                            const int pos = tamSiguiente.fetch_add(enBloque);
+                            for (int j = 0; j < enBloque; ++j) siguiente[pos + j] = bloque[j];
+                            enBloque = 0;
+                        }
+                    }
+                }
+                
+                const int pos = tamSiguiente.fetch_add(enBloque);
+                for (int j = 0; j < enBloque; ++j) siguiente[pos + j] = bloque[j];
+                aristasSiguiente.fetch_add(aristasLocal);
+            });
+        }
+        
+        // La siguiente frontera pasa a ser la actual
+        int* temporal = frontera;
+        frontera = siguiente;
+        siguiente = temporal;
+        tamFrontera = tamSiguiente.load();
+        aristasFrontera = aristasSiguiente.load();
+        aristasSinVisitar -= aristasFrontera;
+        nivel++;
+    }
+    
+    delete[] visitadoBits;
+    delete[] fronteraBits;
+    delete[] frontera;
+    delete[] siguiente;
+    
+    return nivel;
+}
+
+/*
+    funcion: imprimirNiveles
+    Descripcion: Muestra cuántos platillos y restaurantes hay en cada nivel de un BFS
+                 desde el nodo dado, usando el BFS paralelo.
+    Parametros:
+        - nodoInicio: ID del nodo inicial
+    Complejidad: O(V + E)
+*/
+void Graph::imprimirNiveles(int nodoInicio) const {
+    imprimirNiveles(obtenerCSR(), nodoInicio);
+}
+
+/*
+    funcion: imprimirNiveles (sobre un CSR dado)
+    Descripcion: Igual que la versión anterior, pero el BFS recorre el CSR que se le pasa
+                 (un subgrafo con los mismos IDs de nodo).
+    Parametros:
+        - g: CSR con los mismos numNodos que el grafo
+        - nodoInicio: ID del nodo inicial
+    Complejidad: O(V + E)
+*/
+void Graph::imprimirNiveles(const GrafoCSR& g, int nodoInicio) const {
+    if (nodoInicio < 0 || nodoInicio >= numNodos || g.numNodos != numNodos) {
+        std::cout << "Nodo de inicio inválido." << std::endl;
+        return;
+    }
+    
+    int* distancias = new int[numNodos];
+    const int niveles = calcularNivelesBFS(g, nodoInicio, distancias);
+    
+    int* platillosPorNivel = new int[niveles];
+    int* restaurantesPorNivel = new int[niveles];
+    for (int i = 0; i < niveles; ++i) {
+        platillosPorNivel[i] = 0;
+        restaurantesPorNivel[i] = 0;
+    }
+    
+    int alcanzables = 0;
+    for (int i = 0; i < numNodos; ++i) {
+        if (distancias[i] < 0) continue;
+        alcanzables++;
+        if (grafo[i].tipo == 'P') platillosPorNivel[distancias[i]]++;
+        else restaurantesPorNivel[distancias[i]]++;
+    }
+    
+    std::cout << "\n===== Alcance por niveles desde: " << grafo[nodoInicio].nombre 
+              << " (Tipo: " << grafo[nodoInicio].tipo << ") =====" << std::endl;
+    for (int i = 0; i < niveles; ++i) {
+        std::cout << "  Nivel " << i << ": " << platillosPorNivel[i] + restaurantesPorNivel[i] 
+                  << " nodos (" << platillosPorNivel[i] << " platillos, " 
+                  << restaurantesPorNivel[i] << " restaurantes)" << std::endl;
+    }
+    std::cout << "Nodos alcanzables: " << alcanzables << " de " << numNodos << std::endl;
+    std::cout << "=================================================" << std::endl;
+    
+    delete[] distancias;
+    delete[] platillosPorNivel;
+    delete[] restaurantesPorNivel;
+}
+
 /*
     funcion: ejecutarDFS
     Descripcion: Búsqueda en Profundidad (DFS) - explora tan lejos como sea posible
@@ -290,62 +1048,218 @@ void Graph::ejecutarDFS(int nodoInicio) const {
         return;
     }
     
-    bool* visitado = new bool[numNodos];
-    for (int i = 0; i < numNodos; ++i) {
-        visitado[i] = false;
-    }
+    int* orden = new int[numNodos];
+    const int visitadosTotal = recorridoDFS(nodoInicio, orden, numNodos);
     
     std::cout << "\n===== DFS desde: " << grafo[nodoInicio].nombre 
               << " (Tipo: " << grafo[nodoInicio].tipo << ") =====" << std::endl;
     std::cout << "Recorrido DFS: ";
     
-    dfsRecursivo(nodoInicio, visitado);
+    for (int i = 0; i < visitadosTotal; ++i) {
+        std::cout << grafo[orden[i]].nombre;
+        if (grafo[orden[i]].tipo == 'R') std::cout << "(R)";
+        else std::cout << "(P)";
+        std::cout << " ";
+    }
     
     std::cout << std::endl;
     std::cout << "===== Fin DFS =====" << std::endl;
     
-    delete[] visitado;
+    delete[] orden;
+}
+
+/*
+    funcion: recorridoDFS
+    Descripcion: DFS iterativo con pila explícita. Cada entrada de la pila guarda el nodo
+                 y la siguiente posición de su rango en el CSR, así que el orden de visita
+                 es el mismo que el de la versión recursiva (preorden, vecinos en el orden
+                 de su lista) sin arriesgar desbordar la pila del programa en grafos grandes.
+    
+    ALGORITMO:
+    1. Visitar el nodo inicial y meterlo a la pila
+    2. Mientras la pila no esté vacía:
+       a. Tomar el nodo del tope y avanzar su cursor hasta un vecino no visitado
+       b. Si lo hay, visitarlo y meterlo a la pila
+       c. Si no, sacar el nodo (retroceder)
+    
+    Parametros:
+        - nodoInicio: ID del nodo inicial
+        - orden: Buffer donde se escriben los IDs en orden de visita
+        - capacidad: Tamaño del buffer; los nodos que no quepan se recorren pero no se escriben
+    Return: Número de nodos visitados, -1 si el nodo inicial es inválido
+    Complejidad: O(V + E)
+*/
+int Graph::recorridoDFS(int nodoInicio, int* orden, int capacidad) const {
+    if (nodoInicio < 0 || nodoInicio >= numNodos) return -1;
+    
+    const GrafoCSR& g = obtenerCSR();
+    asegurarEspacioRecorrido();
+    for (int i = 0; i < numNodos; ++i) {
+        visitados[i] = false;
+    }
+    
+    int visitadosTotal = 0;
+    int tope = 0;
+    
+    visitados[nodoInicio] = true;
+    if (visitadosTotal < capacidad) orden[visitadosTotal] = nodoInicio;
+    visitadosTotal++;
+    pilaNodos[tope] = nodoInicio;
+    pilaCursores[tope] = g.offsets[nodoInicio];
+    tope++;
+    
+    while (tope > 0) {
+        const int nodo = pilaNodos[tope - 1];
+        int& cursor = pilaCursores[tope - 1];
+        const int fin = g.offsets[nodo + 1];
+        
+        // Avanzar hasta el siguiente vecino sin visitar
+        while (cursor < fin && visitados[g.vecinos[cursor]]) {
+            cursor++;
+        }
+        
+        if (cursor == fin) {
+            tope--;  // Sin vecinos pendientes: retroceder
+            continue;
+        }
+        
+        const int siguiente = g.vecinos[cursor++];
+        visitados[siguiente] = true;
+        if (visitadosTotal < capacidad) orden[visitadosTotal] = siguiente;
+        visitadosTotal++;
+        pilaNodos[tope] = siguiente;
+        pilaCursores[tope] = g.offsets[siguiente];
+        tope++;
+    }
+    
+    return visitadosTotal;
 }
 
 /*
-    funcion: dfsRecursivo
-    Descripcion: Función auxiliar recursiva para DFS.
+    funcion: vecindarioKSaltos
+    Descripcion: BFS acotado para consultas interactivas (ej. "restaurantes a 2 saltos de
+                 Sushi Roll con al menos 5 pedidos"). Sólo sigue aristas con peso >= pesoMinimo,
+                 no expande más allá de maxSaltos y se detiene en cuanto junta maxResultados.
+                 Las marcas de visitado son por época, así que no se limpian V casillas:
+                 el costo depende de la parte del grafo que se explora, no de su tamaño.
     Parametros:
-        - nodo: Nodo actual
-        - visitado: Arreglo de nodos visitados
-    Complejidad: O(V + E) en total
+        - nodoInicio: ID del nodo inicial (no se incluye en los resultados)
+        - maxSaltos: Distancia máxima en aristas
+        - maxResultados: Máximo de nodos a regresar (tamaño de los buffers)
+        - pesoMinimo: Peso mínimo de las aristas que se pueden seguir
+        - tipo: 'P' o 'R' para regresar sólo ese tipo; cualquier otro valor regresa ambos
+                (los nodos del otro tipo se siguen recorriendo como paso intermedio)
+        - resultados: Buffer para los IDs encontrados, en orden BFS
+        - saltos: Buffer paralelo con la distancia de cada resultado
+    Return: Número de resultados, -1 si el nodo inicial es inválido
+    Complejidad: O(nodos y aristas explorados dentro de maxSaltos)
 */
-void Graph::dfsRecursivo(int nodo, bool* visitado) const {
-    visitado[nodo] = true;
-    std::cout << grafo[nodo].nombre;
-    if (grafo[nodo].tipo == 'R') std::cout << "(R)";
-    else std::cout << "(P)";
-    std::cout << " ";
+int Graph::vecindarioKSaltos(int nodoInicio, int maxSaltos, int maxResultados, int pesoMinimo, char tipo,
+                             int* resultados, int* saltos) const {
+    if (nodoInicio < 0 || nodoInicio >= numNodos) return -1;
+    if (maxSaltos <= 0 || maxResultados <= 0) return 0;
+    
+    const GrafoCSR& g = obtenerCSR();
+    asegurarEspacioRecorrido();
+    if (epocaRecorrido == 2147483647) {
+        for (int i = 0; i < capacidadRecorrido; ++i) {
+            marcasRecorrido[i] = 0;
+        }
+        epocaRecorrido = 0;
+    }
+    const int epoca = ++epocaRecorrido;
+    const bool filtrarTipo = (tipo == 'P' || tipo == 'R');
+    
+    // La pila del DFS sirve como cola: pilaNodos guarda el nodo y pilaCursores su distancia
+    int frente = 0;
+    int final = 0;
+    int encontrados = 0;
+    marcasRecorrido[nodoInicio] = epoca;
+    pilaNodos[final] = nodoInicio;
+    pilaCursores[final] = 0;
+    final++;
     
-    NodoAdyacencia* vecino = grafo[nodo].cabezaLista;
-    while (vecino != nullptr) {
-        if (!visitado[vecino->idDestino]) {
-            dfsRecursivo(vecino->idDestino, visitado);
+    while (frente < final) {
+        const int nodo = pilaNodos[frente];
+        const int distancia = pilaCursores[frente];
+        frente++;
+        if (distancia == maxSaltos) continue;
+        
+        for (int k = g.offsets[nodo]; k < g.offsets[nodo + 1]; ++k) {
+            const int vecino = g.vecinos[k];
+            if (g.pesos[k] < pesoMinimo || marcasRecorrido[vecino] == epoca) continue;
+            
+            marcasRecorrido[vecino] = epoca;
+            pilaNodos[final] = vecino;
+            pilaCursores[final] = distancia + 1;
+            final++;
+            
+            if (!filtrarTipo || grafo[vecino].tipo == tipo) {
+                resultados[encontrados] = vecino;
+                saltos[encontrados] = distancia + 1;
+                encontrados++;
+                if (encontrados == maxResultados) return encontrados;
+            }
         }
-        vecino = vecino->siguiente;
     }
+    
+    return encontrados;
+}
+
+/*
+    funcion: asegurarEspacioRecorrido
+    Descripcion: Asegura que la pila y las marcas de visitado (booleanas y por época) tengan
+                 espacio para todos los nodos. La memoria se conserva entre recorridos y
+                 sólo crece con el grafo.
+    Complejidad: O(V) si hay que crecer, O(1) en otro caso
+*/
+void Graph::asegurarEspacioRecorrido() const {
+    if (capacidadRecorrido >= numNodos) return;
+    
+    delete[] pilaNodos;
+    delete[] pilaCursores;
+    delete[] visitados;
+    delete[] marcasRecorrido;
+    capacidadRecorrido = numNodos;
+    pilaNodos = new int[capacidadRecorrido];
+    pilaCursores = new int[capacidadRecorrido];
+    visitados = new bool[capacidadRecorrido];
+    marcasRecorrido = new int[capacidadRecorrido];
+    for (int i = 0; i < capacidadRecorrido; ++i) {
+        marcasRecorrido[i] = 0;
+    }
+    epocaRecorrido = 0;
 }
 
 /*
     funcion: buscarNodoPorNombre
-    Descripcion: Busca un nodo por su nombre exacto.
+    Descripcion: Busca un nodo por su nombre exacto, sin importar su tipo. Si existen un
+                 platillo y un restaurante con el mismo nombre, regresa el de menor ID
+                 (el que se creó primero).
     Parametros:
         - nombre: Nombre a buscar
     Return: ID si existe, -1 si no
-    Complejidad: O(n)
+    Complejidad: O(1) esperado
 */
 int Graph::buscarNodoPorNombre(const String& nombre) const {
-    for (int i = 0; i < numNodos; ++i) {
-        if (grafo[i].nombre == nombre) {
-            return i;
-        }
-    }
-    return -1;
+    const int idPlatillo = buscarEnIndice(nombre, 'P');
+    const int idRestaurante = buscarEnIndice(nombre, 'R');
+    if (idPlatillo < 0) return idRestaurante;
+    if (idRestaurante < 0) return idPlatillo;
+    return (idPlatillo < idRestaurante) ? idPlatillo : idRestaurante;
+}
+
+/*
+    funcion: buscarNodo
+    Descripcion: Busca un nodo por nombre y tipo.
+    Parametros:
+        - nombre: Nombre a buscar
+        - tipo: 'P' o 'R'
+    Return: ID si existe, -1 si no
+    Complejidad: O(1) esperado
+*/
+int Graph::buscarNodo(const String& nombre, char tipo) const {
+    return buscarEnIndice(nombre, tipo);
 }
 
 /*
@@ -354,6 +1268,8 @@ int Graph::buscarNodoPorNombre(const String& nombre) const {
     Complejidad: O(V + E)
 */
 void Graph::imprimirGrafo() const {
+    const GrafoCSR& g = obtenerCSR();
+    
     std::cout << "\n========== ESTRUCTURA DEL GRAFO BIDIRECCIONAL ==========" << std::endl;
     std::cout << "Total de nodos: " << numNodos << std::endl;
     std::cout << "---------------------------------------------------------" << std::endl;
@@ -369,14 +1285,12 @@ void Graph::imprimirGrafo() const {
             std::cout << "\n[PLATILLO] " << grafo[i].nombre << " (ID: " << i << ")" << std::endl;
             std::cout << "  Conexiones bidireccionales:" << std::endl;
             
-            NodoAdyacencia* vecino = grafo[i].cabezaLista;
-            if (vecino == nullptr) {
+            if (g.grado(i) == 0) {
                 std::cout << "    (sin conexiones)" << std::endl;
             }
-            while (vecino != nullptr) {
-                std::cout << "    <-> " << grafo[vecino->idDestino].nombre 
-                          << " (pedidos: " << vecino->peso << ")" << std::endl;
-                vecino = vecino->siguiente;
+            for (int k = g.offsets[i]; k < g.offsets[i + 1]; ++k) {
+                std::cout << "    <-> " << grafo[g.vecinos[k]].nombre 
+                          << " (pedidos: " << g.pesos[k] << ")" << std::endl;
             }
         }
     }
@@ -389,14 +1303,12 @@ void Graph::imprimirGrafo() const {
             std::cout << "\n[RESTAURANTE] " << grafo[i].nombre << " (ID: " << i << ")" << std::endl;
             std::cout << "  Platillos que vende:" << std::endl;
             
-            NodoAdyacencia* vecino = grafo[i].cabezaLista;
-            if (vecino == nullptr) {
+            if (g.grado(i) == 0) {
                 std::cout << "    (sin platillos)" << std::endl;
             }
-            while (vecino != nullptr) {
-                std::cout << "    <-> " << grafo[vecino->idDestino].nombre 
-                          << " (pedidos: " << vecino->peso << ")" << std::endl;
-                vecino = vecino->siguiente;
+            for (int k = g.offsets[i]; k < g.offsets[i + 1]; ++k) {
+                std::cout << "    <-> " << grafo[g.vecinos[k]].nombre 
+                          << " (pedidos: " << g.pesos[k] << ")" << std::endl;
             }
         }
     }
@@ -410,46 +1322,13 @@ void Graph::imprimirGrafo() const {
 /*
     funcion: imprimirEstadisticas
     Descripcion: Muestra estadísticas detalladas del grafo bidireccional.
-    Complejidad: O(V + E)
+                 Todos los valores son contadores que mantiene agregarArista.
+    Complejidad: O(1)
 */
 void Graph::imprimirEstadisticas() const {
-    int numPlatillos = 0;
-    int numRestaurantes = 0;
-    int totalAristasContadas = 0;  // Cuenta cada arista 2 veces (bidireccional)
-    int pesoTotal = 0;
-    int maxConexionesPlatillo = 0;
-    int maxConexionesRestaurante = 0;
-    String platilloMasConectado = "";
-    String restauranteMasConectado = "";
-    
-    for (int i = 0; i < numNodos; ++i) {
-        int conexiones = 0;
-        NodoAdyacencia* vecino = grafo[i].cabezaLista;
-        while (vecino != nullptr) {
-            conexiones++;
-            totalAristasContadas++;
-            pesoTotal += vecino->peso;
-            vecino = vecino->siguiente;
-        }
-        
-        if (grafo[i].tipo == 'P') {
-            numPlatillos++;
-            if (conexiones > maxConexionesPlatillo) {
-                maxConexionesPlatillo = conexiones;
-                platilloMasConectado = grafo[i].nombre;
-            }
-        } else {
-            numRestaurantes++;
-            if (conexiones > maxConexionesRestaurante) {
-                maxConexionesRestaurante = conexiones;
-                restauranteMasConectado = grafo[i].nombre;
-            }
-        }
-    }
-    
     // En grafo bidireccional, cada arista se cuenta 2 veces
-    int aristasReales = totalAristasContadas / 2;
-    int pesoReal = pesoTotal / 2;
+    int aristasReales = numAristasDirigidas / 2;
+    long long pesoReal = pesoTotalDirigido / 2;
     
     std::cout << "\n========== ESTADÍSTICAS DEL GRAFO BIDIRECCIONAL ==========" << std::endl;
     std::cout << "Tipo de grafo: NO DIRIGIDO (bidireccional)" << std::endl;
@@ -462,10 +1341,16 @@ void Graph::imprimirEstadisticas() const {
         std::cout << "Peso promedio por arista: " 
                   << static_cast<double>(pesoReal) / aristasReales << std::endl;
     }
-    std::cout << "Platillo más conectado: " << platilloMasConectado 
-              << " (" << maxConexionesPlatillo << " restaurantes)" << std::endl;
-    std::cout << "Restaurante más conectado: " << restauranteMasConectado 
-              << " (" << maxConexionesRestaurante << " platillos)" << std::endl;
+    // Un nodo sin aristas no cuenta como "más conectado"
+    const bool hayPlatillo = platilloMasConectado != -1 && grafo[platilloMasConectado].grado > 0;
+    const bool hayRestaurante = restauranteMasConectado != -1 && grafo[restauranteMasConectado].grado > 0;
+    std::cout << "Platillo más conectado: "
+              << (hayPlatillo ? grafo[platilloMasConectado].nombre : String(""))
+              << " (" << (hayPlatillo ? grafo[platilloMasConectado].grado : 0) << " restaurantes)" << std::endl;
+    std::cout << "Restaurante más conectado: "
+              << (hayRestaurante ? grafo[restauranteMasConectado].nombre : String(""))
+              << " (" << (hayRestaurante ? grafo[restauranteMasConectado].grado : 0) << " platillos)" << std::endl;
+    imprimirComponentes();
     std::cout << "===========================================================" << std::endl;
 }
 
@@ -474,18 +1359,11 @@ void Graph::imprimirEstadisticas() const {
     Descripcion: Muestra todos los restaurantes donde se vende un platillo específico.
     Parametros:
         - nombrePlatillo: Nombre del platillo
-    Complejidad: O(n + k)
+    Complejidad: O(k), donde k es el número de restaurantes del platillo
 */
 void Graph::obtenerRestaurantesDePlatillo(const String& nombrePlatillo) const {
-    int idPlatillo = -1;
-    
     // Buscar el platillo
-    for (int i = 0; i < numNodos; ++i) {
-        if (grafo[i].nombre == nombrePlatillo && grafo[i].tipo == 'P') {
-            idPlatillo = i;
-            break;
-        }
-    }
+    int idPlatillo = buscarEnIndice(nombrePlatillo, 'P');
     
     if (idPlatillo == -1) {
         std::cout << "Platillo '" << nombrePlatillo << "' no encontrado." << std::endl;
@@ -494,16 +1372,15 @@ void Graph::obtenerRestaurantesDePlatillo(const String& nombrePlatillo) const {
     
     std::cout << "\n===== Restaurantes que venden: " << nombrePlatillo << " =====" << std::endl;
     
-    NodoAdyacencia* vecino = grafo[idPlatillo].cabezaLista;
+    const GrafoCSR& g = obtenerCSR();
     int totalPedidos = 0;
     int numRestaurantes = 0;
     
-    while (vecino != nullptr) {
-        std::cout << "  " << grafo[vecino->idDestino].nombre 
-                  << " - " << vecino->peso << " pedidos" << std::endl;
-        totalPedidos += vecino->peso;
+    for (int k = g.offsets[idPlatillo]; k < g.offsets[idPlatillo + 1]; ++k) {
+        std::cout << "  " << grafo[g.vecinos[k]].nombre 
+                  << " - " << g.pesos[k] << " pedidos" << std::endl;
+        totalPedidos += g.pesos[k];
         numRestaurantes++;
-        vecino = vecino->siguiente;
     }
     
     if (numRestaurantes == 0) {
@@ -518,55 +1395,129 @@ void Graph::obtenerRestaurantesDePlatillo(const String& nombrePlatillo) const {
 
 /*
     funcion: obtenerPlatilloMasConectado
-    Descripcion: Encuentra y muestra el platillo con más conexiones a restaurantes.
-    Complejidad: O(V + E)
+    Descripcion: Muestra el platillo con más conexiones a restaurantes (mantenido en
+                 agregarArista) y sus restaurantes.
+    Complejidad: O(k), donde k es el número de restaurantes del platillo
 */
 void Graph::obtenerPlatilloMasConectado() const {
-    int maxConexiones = 0;
-    int maxPedidos = 0;
-    String mejorPlatillo = "";
-    int idMejor = -1;
-    
-    for (int i = 0; i < numNodos; ++i) {
-        if (grafo[i].tipo == 'P') {
-            int conexiones = 0;
-            int pedidos = 0;
-            NodoAdyacencia* vecino = grafo[i].cabezaLista;
-            while (vecino != nullptr) {
-                conexiones++;
-                pedidos += vecino->peso;
-                vecino = vecino->siguiente;
-            }
-            if (conexiones > maxConexiones || 
-                (conexiones == maxConexiones && pedidos > maxPedidos)) {
-                maxConexiones = conexiones;
-                maxPedidos = pedidos;
-                mejorPlatillo = grafo[i].nombre;
-                idMejor = i;
-            }
-        }
-    }
+    const int idMejor = platilloMasConectado;
     
-    if (idMejor == -1) {
+    if (idMejor == -1 || grafo[idMejor].grado == 0) {
         std::cout << "No hay platillos en el grafo." << std::endl;
         return;
     }
     
+    const String& mejorPlatillo = grafo[idMejor].nombre;
+    const int maxConexiones = grafo[idMejor].grado;
+    const int maxPedidos = grafo[idMejor].pesoTotal;
+    const GrafoCSR& g = obtenerCSR();
+    
     std::cout << "\n===== PLATILLO MÁS CONECTADO =====" << std::endl;
     std::cout << "Nombre: " << mejorPlatillo << std::endl;
     std::cout << "Número de restaurantes: " << maxConexiones << std::endl;
     std::cout << "Total de pedidos: " << maxPedidos << std::endl;
     std::cout << "\nRestaurantes:" << std::endl;
     
-    NodoAdyacencia* vecino = grafo[idMejor].cabezaLista;
-    while (vecino != nullptr) {
-        std::cout << "  -> " << grafo[vecino->idDestino].nombre 
-                  << " (" << vecino->peso << " pedidos)" << std::endl;
-        vecino = vecino->siguiente;
+    for (int k = g.offsets[idMejor]; k < g.offsets[idMejor + 1]; ++k) {
+        std::cout << "  -> " << grafo[g.vecinos[k]].nombre 
+                  << " (" << g.pesos[k] << " pedidos)" << std::endl;
     }
     std::cout << "==================================" << std::endl;
 }
 
+/*
+    funcion: mismoComponente
+    Descripcion: Indica si existe un camino entre dos nodos.
+    Parametros:
+        - idA, idB: IDs de los nodos
+    Return: true si están en la misma componente conexa
+    Complejidad: O(α(V)) amortizado
+*/
+bool Graph::mismoComponente(int idA, int idB) const {
+    const int raizA = buscarComponente(idA);
+    return raizA != -1 && raizA == buscarComponente(idB);
+}
+
+/*
+    funcion: getNumComponentes
+    Descripcion: Retorna el número de componentes conexas (los nodos aislados cuentan).
+    Return: Número de componentes
+    Complejidad: O(1)
+*/
+int Graph::getNumComponentes() const {
+    return numComponentes;
+}
+
+/*
+    funcion: getTamanoComponente
+    Descripcion: Retorna cuántos nodos tiene la componente de un nodo.
+    Parametros:
+        - id: ID del nodo
+    Return: Tamaño de su componente, 0 si el nodo no existe
+    Complejidad: O(α(V)) amortizado
+*/
+int Graph::getTamanoComponente(int id) const {
+    const int raiz = buscarComponente(id);
+    return raiz == -1 ? 0 : tamanoComponente[raiz];
+}
+
+/*
+    funcion: getComponenteMasGrande
+    Descripcion: Retorna la raíz de la componente con más nodos.
+    Return: ID de la raíz, -1 si el grafo está vacío
+    Complejidad: O(α(V)) amortizado
+*/
+int Graph::getComponenteMasGrande() const {
+    return buscarComponente(raizMasGrande);
+}
+
+/*
+    funcion: getPlatillosAislados
+    Descripcion: Retorna cuántos platillos no están conectados a ningún restaurante.
+    Return: Número de platillos aislados
+    Complejidad: O(1)
+*/
+int Graph::getPlatillosAislados() const {
+    return platillosAislados;
+}
+
+/*
+    funcion: getRestaurantesAislados
+    Descripcion: Retorna cuántos restaurantes no tienen ningún platillo.
+    Return: Número de restaurantes aislados
+    Complejidad: O(1)
+*/
+int Graph::getRestaurantesAislados() const {
+    return restaurantesAislados;
+}
+
+/*
+    funcion: imprimirComponentes
+    Descripcion: Muestra el resumen de componentes conexas: cuántas hay, la más grande,
+                 los nodos aislados y la distribución de tamaños por rangos de potencias de 2.
+    Complejidad: O(RANGOS_TAMANO), no recorre el grafo
+*/
+void Graph::imprimirComponentes() const {
+    std::cout << "Componentes conexas: " << numComponentes << std::endl;
+    
+    const int raiz = getComponenteMasGrande();
+    if (raiz == -1) return;
+    
+    std::cout << "  - Más grande: " << tamanoComponente[raiz] << " nodos (contiene a "
+              << grafo[raiz].nombre << ")" << std::endl;
+    std::cout << "  - Nodos aislados: " << platillosAislados << " platillos, "
+              << restaurantesAislados << " restaurantes" << std::endl;
+    std::cout << "  - Distribución de tamaños:" << std::endl;
+    for (int k = 0; k < RANGOS_TAMANO; ++k) {
+        if (componentesPorRango[k] == 0) continue;
+        const long long desde = 1LL << k;
+        const long long hasta = (1LL << (k + 1)) - 1;
+        std::cout << "      " << desde;
+        if (hasta > desde) std::cout << "-" << hasta;
+        std::cout << " nodos: " << componentesPorRango[k] << " componentes" << std::endl;
+    }
+}
+
 /*
     funcion: getNumNodos
     Descripcion: Retorna el número de nodos en el grafo.
@@ -577,6 +1528,32 @@ int Graph::getNumNodos() const {
     return numNodos;
 }
 
+/*
+    funcion: getGradoNodo
+    Descripcion: Retorna el número de vecinos distintos de un nodo.
+    Parametros:
+        - id: ID del nodo
+    Return: Grado del nodo, 0 si no existe
+    Complejidad: O(1)
+*/
+int Graph::getGradoNodo(int id) const {
+    if (id < 0 || id >= numNodos) return 0;
+    return grafo[id].grado;
+}
+
+/*
+    funcion: getPesoNodo
+    Descripcion: Retorna la suma de los pesos de las aristas de un nodo.
+    Parametros:
+        - id: ID del nodo
+    Return: Pedidos totales del nodo, 0 si no existe
+    Complejidad: O(1)
+*/
+int Graph::getPesoNodo(int id) const {
+    if (id < 0 || id >= numNodos) return 0;
+    return grafo[id].pesoTotal;
+}
+
 /*
     funcion: getNombreNodo
     Descripcion: Retorna el nombre de un nodo.
@@ -605,14 +1582,39 @@ char Graph::getTipoNodo(int id) const {
 
 /*
     funcion: limpiarGrafo
-    Descripcion: Elimina todos los nodos y aristas del grafo.
-    Complejidad: O(V + E)
+    Descripcion: Elimina todos los nodos y aristas del grafo. Las aristas se descartan
+                 reiniciando la arena, sin recorrer las listas. Los índices hash conservan
+                 su capacidad para la siguiente construcción.
+    Complejidad: O(V + capacidad de los índices)
 */
 void Graph::limpiarGrafo() {
     for (int i = 0; i < numNodos; ++i) {
         grafo[i].limpiarLista();
         grafo[i].nombre = "";
         grafo[i].tipo = ' ';
+        grafo[i].grado = 0;
+        grafo[i].pesoTotal = 0;
     }
     numNodos = 0;
+    numAristasDirigidas = 0;
+    pesoTotalDirigido = 0;
+    numPlatillos = 0;
+    numRestaurantes = 0;
+    platilloMasConectado = -1;
+    restauranteMasConectado = -1;
+    csrValido = false;
+    numComponentes = 0;
+    raizMasGrande = -1;
+    platillosAislados = 0;
+    restaurantesAislados = 0;
+    for (int i = 0; i < RANGOS_TAMANO; ++i) {
+        componentesPorRango[i] = 0;
+    }
+    for (int i = 0; i < capacidadIndice; ++i) {
+        indiceIds[i] = -1;
+    }
+    for (int i = 0; i < capacidadIndiceAristas; ++i) {
+        indiceAristasNodos[i] = nullptr;
+    }
+    arenaAristas.reset();
 }
@@ -0,0 +1,85 @@
+#include "HourSlot.hpp"
+
+/*
+    funcion: HourSlot (Constructor por defecto)
+    Descripcion: Inicializa la franja de las 00:00 sin pedidos.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(1)
+*/
+HourSlot::HourSlot() {
+}
+
+/*
+    funcion: HourSlot (Constructor con hora)
+    Descripcion: Inicializa la franja horaria indicada sin pedidos.
+    Parametros:
+        - hour (int): Hora del día (0-23).
+    Return: N/A
+    Complejidad: O(1)
+*/
+HourSlot::HourSlot(int hour) {
+    this->hour = hour;
+}
+
+/*
+    funcion: getName
+    Descripcion: Devuelve la franja en formato "HH:00-HH:59" para mostrarla en los rankings.
+    Parametros: Ninguno
+    Return: (String) Nombre de la franja horaria.
+    Complejidad: O(1)
+*/
+String HourSlot::getName() const {
+    char text[12];
+    text[0] = static_cast<char>('0' + hour / 10);
+    text[1] = static_cast<char>('0' + hour % 10);
+    text[2] = ':'; text[3] = '0'; text[4] = '0'; text[5] = '-';
+    text[6] = text[0];
+    text[7] = text[1];
+    text[8] = ':'; text[9] = '5'; text[10] = '9'; text[11] = '\0';
+    return String(text);
+}
+
+/*
+    funcion: getHour
+    Descripcion: Devuelve la hora del día de la franja.
+    Parametros: Ninguno
+    Return: (int) Hora (0-23).
+    Complejidad: O(1)
+*/
+int HourSlot::getHour() const {
+    return hour;
+}
+
+/*
+    funcion: getTotalOrders
+    Descripcion: Obtiene la cantidad de pedidos hechos en esta franja horaria.
+    Parametros: Ninguno
+    Return: (int) Número de pedidos.
+    Complejidad: O(1)
+*/
+int HourSlot::getTotalOrders() const {
+    return totalOrders;
+}
+
+/*
+    funcion: addOrder
+    Descripcion: Incrementa en uno el contador de pedidos de la franja.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(1)
+*/
+void HourSlot::addOrder() {
+    totalOrders++;
+}
+
+/*
+    funcion: removeOrder
+    Descripcion: Decrementa en uno el contador de pedidos de la franja (cancelación).
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(1)
+*/
+void HourSlot::removeOrder() {
+    if (totalOrders > 0) totalOrders--;
+}
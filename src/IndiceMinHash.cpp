@@ -0,0 +1,306 @@
+#include "IndiceMinHash.hpp"
+#include "Hilos.hpp"
+#include "TopK.hpp"
+#include <iostream>
+
+/*
+    funcion: IndiceMinHash (Constructor)
+    Descripcion: Inicializa un índice vacío y fija las funciones hash. Usa una semilla
+                 fija para que las firmas (y los candidatos) sean iguales en cada ejecución.
+    Complejidad: O(NUM_HASHES)
+*/
+IndiceMinHash::IndiceMinHash()
+    : numNodos(0), numFilas(0), filaDeNodo(nullptr), nodoDeFila(nullptr), firmas(nullptr),
+      llavesBanda(nullptr), cabezasCubeta(nullptr), siguienteEnCubeta(nullptr), capacidadCubetas(0),
+      marcas(nullptr), epoca(0), enMenu(nullptr) {
+    unsigned long long semilla = 0x9e3779b97f4a7c15ULL;
+    for (int i = 0; i < NUM_HASHES; ++i) {
+        semilla += 0x9e3779b97f4a7c15ULL;
+        multiplicadores[i] = mezclar(semilla) | 1ULL;  // Impar, para la familia multiplicar-desplazar
+        semilla += 0x9e3779b97f4a7c15ULL;
+        sumandos[i] = mezclar(semilla);
+    }
+}
+
+/*
+    funcion: ~IndiceMinHash (Destructor)
+    Descripcion: Libera los arreglos del índice.
+    Complejidad: O(1)
+*/
+IndiceMinHash::~IndiceMinHash() {
+    limpiar();
+}
+
+/*
+    funcion: limpiar
+    Descripcion: Descarta las firmas y las cubetas.
+    Complejidad: O(1)
+*/
+void IndiceMinHash::limpiar() {
+    delete[] filaDeNodo;
+    delete[] nodoDeFila;
+    delete[] firmas;
+    delete[] llavesBanda;
+    delete[] cabezasCubeta;
+    delete[] siguienteEnCubeta;
+    delete[] marcas;
+    delete[] enMenu;
+    filaDeNodo = nullptr;
+    nodoDeFila = nullptr;
+    firmas = nullptr;
+    llavesBanda = nullptr;
+    cabezasCubeta = nullptr;
+    siguienteEnCubeta = nullptr;
+    marcas = nullptr;
+    enMenu = nullptr;
+    numNodos = 0;
+    numFilas = 0;
+    capacidadCubetas = 0;
+    epoca = 0;
+}
+
+/*
+    funcion: mezclar
+    Descripcion: Mezcla de bits de 64 bits (finalizador de SplitMix64).
+    Parametros:
+        - valor: Valor a mezclar
+    Return: Valor mezclado
+    Complejidad: O(1)
+*/
+unsigned long long IndiceMinHash::mezclar(unsigned long long valor) {
+    valor ^= valor >> 30;
+    valor *= 0xbf58476d1ce4e5b9ULL;
+    valor ^= valor >> 27;
+    valor *= 0x94d049bb133111ebULL;
+    valor ^= valor >> 31;
+    return valor;
+}
+
+/*
+    funcion: llaveDeBanda
+    Descripcion: Combina los FILAS_POR_BANDA valores de una banda de la firma en una llave.
+    Parametros:
+        - fila: Fila (restaurante) del índice
+        - banda: Número de banda
+    Return: Llave de 64 bits de la banda
+    Complejidad: O(FILAS_POR_BANDA)
+*/
+unsigned long long IndiceMinHash::llaveDeBanda(int fila, int banda) const {
+    const unsigned int* valores = firmas + static_cast<long long>(fila) * NUM_HASHES + banda * FILAS_POR_BANDA;
+    unsigned long long llave = static_cast<unsigned long long>(banda);
+    for (int i = 0; i < FILAS_POR_BANDA; ++i) {
+        llave = mezclar(llave ^ valores[i]);
+    }
+    return llave;
+}
+
+/*
+    funcion: construir
+    Descripcion: Calcula la firma MinHash de cada restaurante y llena las cubetas LSH.
+                 firma[i] = mínimo sobre sus platillos p de h_i(p), con h_i(p) los 32 bits
+                 altos de (a_i * (p + 1) + b_i). Las firmas se calculan en paralelo (cada
+                 hilo escribe sólo las filas de su rango); las cubetas se llenan después,
+                 banda por banda, con listas enlazadas en arreglos.
+    Parametros:
+        - grafo: Grafo Platillo-Restaurante
+        - numHilos: Hilos a usar; 0 usa todos los núcleos
+    Complejidad: O(E * NUM_HASHES / hilos + R * BANDAS)
+*/
+void IndiceMinHash::construir(const Graph& grafo, int numHilos) {
+    limpiar();
+
+    const GrafoCSR& g = grafo.obtenerCSR();
+    numNodos = grafo.getNumNodos();
+
+    // Numerar los restaurantes
+    filaDeNodo = new int[numNodos > 0 ? numNodos : 1];
+    nodoDeFila = new int[numNodos > 0 ? numNodos : 1];
+    for (int i = 0; i < numNodos; ++i) {
+        if (grafo.getTipoNodo(i) == 'R') {
+            filaDeNodo[i] = numFilas;
+            nodoDeFila[numFilas++] = i;
+        } else {
+            filaDeNodo[i] = -1;
+        }
+    }
+
+    // Firmas
+    firmas = new unsigned int[static_cast<long long>(numFilas > 0 ? numFilas : 1) * NUM_HASHES];
+    const int hilos = hilosParaTrabajo(numeroDeHilos(numHilos), g.numAristas, 4096);
+    ejecutarEnHilos(hilos, [&](int h) {
+        const int inicio = static_cast<int>(static_cast<long long>(numFilas) * h / hilos);
+        const int fin = static_cast<int>(static_cast<long long>(numFilas) * (h + 1) / hilos);
+        for (int fila = inicio; fila < fin; ++fila) {
+            unsigned int* firma = firmas + static_cast<long long>(fila) * NUM_HASHES;
+            for (int i = 0; i < NUM_HASHES; ++i) {
+                firma[i] = 0xFFFFFFFFu;
+            }
+            const int nodo = nodoDeFila[fila];
+            for (int k = g.offsets[nodo]; k < g.offsets[nodo + 1]; ++k) {
+                const unsigned long long platillo = static_cast<unsigned long long>(g.vecinos[k]) + 1;
+                for (int i = 0; i < NUM_HASHES; ++i) {
+                    const unsigned int valor = static_cast<unsigned int>((multiplicadores[i] * platillo + sumandos[i]) >> 32);
+                    if (valor < firma[i]) firma[i] = valor;
+                }
+            }
+        }
+    });
+
+    // Cubetas LSH: una tabla por banda
+    capacidadCubetas = 16;
+    while (capacidadCubetas < 2 * numFilas) {
+        capacidadCubetas *= 2;
+    }
+    const int mascara = capacidadCubetas - 1;
+    llavesBanda = new unsigned long long[static_cast<long long>(BANDAS) * (numFilas > 0 ? numFilas : 1)];
+    siguienteEnCubeta = new int[static_cast<long long>(BANDAS) * (numFilas > 0 ? numFilas : 1)];
+    cabezasCubeta = new int[static_cast<long long>(BANDAS) * capacidadCubetas];
+    for (long long i = 0; i < static_cast<long long>(BANDAS) * capacidadCubetas; ++i) {
+        cabezasCubeta[i] = -1;
+    }
+
+    for (int banda = 0; banda < BANDAS; ++banda) {
+        int* cabezas = cabezasCubeta + static_cast<long long>(banda) * capacidadCubetas;
+        for (int fila = 0; fila < numFilas; ++fila) {
+            if (g.grado(nodoDeFila[fila]) == 0) continue;  // Sin menú: no hay nada que comparar
+            const long long posicion = static_cast<long long>(banda) * numFilas + fila;
+            const unsigned long long llave = llaveDeBanda(fila, banda);
+            const int cubeta = static_cast<int>(llave & static_cast<unsigned long long>(mascara));
+            llavesBanda[posicion] = llave;
+            siguienteEnCubeta[posicion] = cabezas[cubeta];
+            cabezas[cubeta] = fila;
+        }
+    }
+
+    marcas = new int[numFilas > 0 ? numFilas : 1];
+    for (int i = 0; i < numFilas; ++i) {
+        marcas[i] = 0;
+    }
+    enMenu = new bool[numNodos > 0 ? numNodos : 1];
+    for (int i = 0; i < numNodos; ++i) {
+        enMenu[i] = false;
+    }
+}
+
+/*
+    funcion: contarCompartidos
+    Descripcion: Cuenta cuántos platillos de un restaurante están marcados en 'enMenu'
+                 (el menú del restaurante consultado).
+    Parametros:
+        - g: Forma CSR del grafo
+        - nodo: ID del restaurante candidato
+    Return: Platillos en común
+    Complejidad: O(grado del candidato)
+*/
+int IndiceMinHash::contarCompartidos(const GrafoCSR& g, int nodo) const {
+    int compartidos = 0;
+    for (int k = g.offsets[nodo]; k < g.offsets[nodo + 1]; ++k) {
+        if (enMenu[g.vecinos[k]]) compartidos++;
+    }
+    return compartidos;
+}
+
+/*
+    funcion: esMasParecido
+    Descripcion: Orden de los resultados: mayor similitud y, en empate, menor ID.
+    Parametros:
+        - a, b: Resultados a comparar
+    Return: true si 'a' va antes que 'b'
+    Complejidad: O(1)
+*/
+bool IndiceMinHash::esMasParecido(const RestauranteSimilar& a, const RestauranteSimilar& b) {
+    if (a.similitud != b.similitud) return a.similitud > b.similitud;
+    return a.restaurante < b.restaurante;
+}
+
+/*
+    funcion: buscarSimilares
+    Descripcion: Encuentra los restaurantes con menú más parecido al del restaurante dado.
+                 Sólo revisa los candidatos que comparten alguna banda completa de la firma;
+                 a cada candidato se le calcula el Jaccard exacto y se devuelven los mejores,
+                 de mayor a menor similitud (en empate, menor ID). Si hay menos candidatos
+                 que 'capacidad' se devuelven sólo esos.
+    Parametros:
+        - grafo: Grafo con el que se construyó el índice
+        - nodo: ID del restaurante a consultar
+        - resultado: Buffer para los restaurantes similares
+        - capacidad: Máximo de resultados
+    Return: Número de resultados escritos, -1 si el nodo no es un restaurante indexado
+    Complejidad: O(BANDAS * tamaño de cubeta + suma de grados de los candidatos)
+*/
+int IndiceMinHash::buscarSimilares(const Graph& grafo, int nodo, RestauranteSimilar* resultado, int capacidad) const {
+    if (filaDeNodo == nullptr || nodo < 0 || nodo >= numNodos || filaDeNodo[nodo] < 0) return -1;
+
+    const GrafoCSR& g = grafo.obtenerCSR();
+    const int fila = filaDeNodo[nodo];
+    const int gradoConsulta = g.grado(nodo);
+    if (gradoConsulta == 0 || capacidad <= 0) return 0;
+
+    for (int k = g.offsets[nodo]; k < g.offsets[nodo + 1]; ++k) {
+        enMenu[g.vecinos[k]] = true;
+    }
+    epoca++;
+    marcas[fila] = epoca;
+
+    int encontrados = 0;
+    const int mascara = capacidadCubetas - 1;
+    for (int banda = 0; banda < BANDAS; ++banda) {
+        const unsigned long long llave = llavesBanda[static_cast<long long>(banda) * numFilas + fila];
+        const int* cabezas = cabezasCubeta + static_cast<long long>(banda) * capacidadCubetas;
+        int actual = cabezas[llave & static_cast<unsigned long long>(mascara)];
+
+        while (actual != -1) {
+            const long long posicion = static_cast<long long>(banda) * numFilas + actual;
+            if (marcas[actual] != epoca && llavesBanda[posicion] == llave) {
+                marcas[actual] = epoca;
+
+                const int candidato = nodoDeFila[actual];
+                RestauranteSimilar similar;
+                similar.restaurante = candidato;
+                similar.compartidos = contarCompartidos(g, candidato);
+                similar.similitud = static_cast<float>(similar.compartidos)
+                                    / static_cast<float>(gradoConsulta + g.grado(candidato) - similar.compartidos);
+
+                insertarEnTop(resultado, encontrados, capacidad, similar, esMasParecido);
+            }
+            actual = siguienteEnCubeta[posicion];
+        }
+    }
+
+    for (int k = g.offsets[nodo]; k < g.offsets[nodo + 1]; ++k) {
+        enMenu[g.vecinos[k]] = false;
+    }
+    return encontrados;
+}
+
+/*
+    funcion: imprimirSimilares
+    Descripcion: Muestra los restaurantes con menú más parecido al del restaurante dado.
+    Parametros:
+        - grafo: Grafo con el que se construyó el índice
+        - nodo: ID del restaurante
+        - n: Máximo de restaurantes a mostrar
+    Complejidad: La de buscarSimilares
+*/
+void IndiceMinHash::imprimirSimilares(const Graph& grafo, int nodo, int n) const {
+    if (n <= 0) {
+        std::cout << "El número de restaurantes debe ser mayor que 0." << std::endl;
+        return;
+    }
+
+    RestauranteSimilar* similares = new RestauranteSimilar[n];
+    const int cuenta = buscarSimilares(grafo, nodo, similares, n);
+
+    std::cout << "\n===== Restaurantes con menú parecido a: " << grafo.getNombreNodo(nodo) << " =====" << std::endl;
+    if (cuenta <= 0) {
+        std::cout << "  (no se encontraron menús parecidos)" << std::endl;
+    }
+    for (int i = 0; i < cuenta; ++i) {
+        std::cout << "  " << i + 1 << ". " << grafo.getNombreNodo(similares[i].restaurante)
+                  << " - " << similares[i].compartidos << " platillos en común"
+                  << " (similitud " << similares[i].similitud << ")" << std::endl;
+    }
+    std::cout << "================================================" << std::endl;
+
+    delete[] similares;
+}
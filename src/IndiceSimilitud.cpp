@@ -0,0 +1,210 @@
+#include "IndiceSimilitud.hpp"
+#include "Hilos.hpp"
+#include "TopK.hpp"
+#include <atomic>
+#include <iostream>
+
+/*
+    funcion: IndiceSimilitud (Constructor)
+    Descripcion: Inicializa un índice vacío (sin construir).
+    Complejidad: O(1)
+*/
+IndiceSimilitud::IndiceSimilitud() : offsets(nullptr), pares(nullptr), numNodos(0), topK(0) {
+}
+
+/*
+    funcion: ~IndiceSimilitud (Destructor)
+    Descripcion: Libera los arreglos del índice.
+    Complejidad: O(1)
+*/
+IndiceSimilitud::~IndiceSimilitud() {
+    limpiar();
+}
+
+/*
+    funcion: limpiar
+    Descripcion: Descarta el índice calculado.
+    Complejidad: O(1)
+*/
+void IndiceSimilitud::limpiar() {
+    delete[] offsets;
+    delete[] pares;
+    offsets = nullptr;
+    pares = nullptr;
+    numNodos = 0;
+    topK = 0;
+}
+
+/*
+    funcion: estaConstruido
+    Descripcion: Indica si el índice ya fue calculado.
+    Return: true si hay un índice disponible
+    Complejidad: O(1)
+*/
+bool IndiceSimilitud::estaConstruido() const {
+    return offsets != nullptr;
+}
+
+/*
+    funcion: esMasSimilar
+    Descripcion: Orden del top K: mayor similitud, luego más restaurantes compartidos y,
+                 en empate total, menor ID (para que el resultado no dependa de los hilos).
+    Parametros:
+        - a, b: Pares a comparar
+    Return: true si 'a' va antes que 'b'
+    Complejidad: O(1)
+*/
+bool IndiceSimilitud::esMasSimilar(const ParSimilar& a, const ParSimilar& b) {
+    if (a.similitud != b.similitud) return a.similitud > b.similitud;
+    if (a.compartidos != b.compartidos) return a.compartidos > b.compartidos;
+    return a.platillo < b.platillo;
+}
+
+/*
+    funcion: construir
+    Descripcion: Calcula los K platillos más parecidos a cada platillo del grafo.
+
+    ALGORITMO (Gustavson, una fila de A * A^T por platillo p):
+    1. Para cada restaurante r vecino de p y cada platillo q vecino de r (q != p),
+       sumar 1 en el acumulador denso de q y recordar q la primera vez que aparece
+    2. Para cada q recordado: compartidos = acumulador[q],
+       similitud = compartidos / (grado(p) + grado(q) - compartidos)   (Jaccard)
+    3. Quedarse con los K mejores y limpiar sólo las casillas usadas del acumulador
+
+    Las filas se reparten dinámicamente entre hilos (un contador atómico), porque el
+    trabajo de cada platillo depende de qué tan populares son sus restaurantes. Cada hilo
+    tiene su propio acumulador, así que no hay escrituras compartidas.
+
+    Parametros:
+        - grafo: Grafo Platillo-Restaurante
+        - k: Número de similares a guardar por platillo
+        - numHilos: Hilos a usar; 0 usa todos los núcleos
+    Complejidad: O(sum sobre restaurantes de grado(r)^2 + P * k) de trabajo total
+*/
+void IndiceSimilitud::construir(const Graph& grafo, int k, int numHilos) {
+    limpiar();
+    if (k <= 0) return;
+
+    const GrafoCSR& g = grafo.obtenerCSR();
+    const int n = grafo.getNumNodos();
+    numNodos = n;
+    topK = k;
+
+    ParSimilar* temporal = new ParSimilar[static_cast<long long>(n) * k];
+    int* cuentas = new int[n];
+    for (int i = 0; i < n; ++i) {
+        cuentas[i] = 0;
+    }
+
+    const int hilos = hilosParaTrabajo(numeroDeHilos(numHilos), n, 64);
+    std::atomic<int> siguienteFila(0);
+    const int FILAS_POR_TOMA = 16;
+
+    ejecutarEnHilos(hilos, [&](int) {
+        int* acumulador = new int[n];
+        int* tocados = new int[n];
+        for (int i = 0; i < n; ++i) {
+            acumulador[i] = 0;
+        }
+
+        while (true) {
+            const int inicio = siguienteFila.fetch_add(FILAS_POR_TOMA);
+            if (inicio >= n) break;
+            const int fin = (inicio + FILAS_POR_TOMA < n) ? inicio + FILAS_POR_TOMA : n;
+
+            for (int p = inicio; p < fin; ++p) {
+                if (grafo.getTipoNodo(p) != 'P') continue;
+
+                int numTocados = 0;
+                for (int a = g.offsets[p]; a < g.offsets[p + 1]; ++a) {
+                    const int r = g.vecinos[a];
+                    for (int b = g.offsets[r]; b < g.offsets[r + 1]; ++b) {
+                        const int q = g.vecinos[b];
+                        if (q == p) continue;
+                        if (acumulador[q] == 0) tocados[numTocados++] = q;
+                        acumulador[q]++;
+                    }
+                }
+
+                ParSimilar* top = temporal + static_cast<long long>(p) * k;
+                int enTop = 0;
+                const int gradoP = g.grado(p);
+                for (int t = 0; t < numTocados; ++t) {
+                    const int q = tocados[t];
+                    ParSimilar candidato;
+                    candidato.platillo = q;
+                    candidato.compartidos = acumulador[q];
+                    candidato.similitud = static_cast<float>(acumulador[q])
+                                          / static_cast<float>(gradoP + g.grado(q) - acumulador[q]);
+                    insertarEnTop(top, enTop, k, candidato, esMasSimilar);
+                    acumulador[q] = 0;
+                }
+                cuentas[p] = enTop;
+            }
+        }
+
+        delete[] acumulador;
+        delete[] tocados;
+    });
+
+    // Compactar las filas en formato CSR
+    offsets = new int[n + 1];
+    int total = 0;
+    for (int i = 0; i < n; ++i) {
+        offsets[i] = total;
+        total += cuentas[i];
+    }
+    offsets[n] = total;
+
+    pares = new ParSimilar[total > 0 ? total : 1];
+    for (int i = 0; i < n; ++i) {
+        const ParSimilar* fila = temporal + static_cast<long long>(i) * k;
+        for (int j = 0; j < cuentas[i]; ++j) {
+            pares[offsets[i] + j] = fila[j];
+        }
+    }
+
+    delete[] temporal;
+    delete[] cuentas;
+}
+
+/*
+    funcion: obtenerSimilares
+    Descripcion: Da acceso a los similares guardados de un nodo, de más a menos parecido.
+    Parametros:
+        - nodo: ID del platillo en el grafo
+        - similares: Recibe un puntero al primer par (válido hasta reconstruir el índice)
+    Return: Número de similares, 0 si el nodo no es válido o el índice no existe
+    Complejidad: O(1)
+*/
+int IndiceSimilitud::obtenerSimilares(int nodo, const ParSimilar*& similares) const {
+    similares = nullptr;
+    if (offsets == nullptr || nodo < 0 || nodo >= numNodos) return 0;
+    similares = pares + offsets[nodo];
+    return offsets[nodo + 1] - offsets[nodo];
+}
+
+/*
+    funcion: imprimirSimilares
+    Descripcion: Muestra los platillos que más se venden en los mismos restaurantes que
+                 el platillo dado.
+    Parametros:
+        - grafo: Grafo con el que se construyó el índice
+        - nodo: ID del platillo
+    Complejidad: O(k)
+*/
+void IndiceSimilitud::imprimirSimilares(const Graph& grafo, int nodo) const {
+    const ParSimilar* similares = nullptr;
+    const int cuenta = obtenerSimilares(nodo, similares);
+
+    std::cout << "\n===== Platillos similares a: " << grafo.getNombreNodo(nodo) << " =====" << std::endl;
+    if (cuenta == 0) {
+        std::cout << "  (no comparte restaurantes con otros platillos)" << std::endl;
+    }
+    for (int i = 0; i < cuenta; ++i) {
+        std::cout << "  " << i + 1 << ". " << grafo.getNombreNodo(similares[i].platillo)
+                  << " - " << similares[i].compartidos << " restaurantes en común"
+                  << " (similitud " << similares[i].similitud << ")" << std::endl;
+    }
+    std::cout << "================================================" << std::endl;
+}
@@ -0,0 +1,344 @@
+#include "LineaTiempoGrafo.hpp"
+
+/*
+    funcion: LineaTiempoGrafo (Constructor)
+    Descripcion: Inicializa una línea de tiempo vacía.
+    Complejidad: O(1)
+*/
+LineaTiempoGrafo::LineaTiempoGrafo()
+    : eventosPlatillo(nullptr), eventosRestaurante(nullptr), eventosDia(nullptr),
+      numEventos(0), capacidadEventos(0), numNodos(0), offsets(nullptr), vecinos(nullptr),
+      inicioSerie(nullptr), dias(nullptr), acumulados(nullptr), numAristas(0) {
+}
+
+/*
+    funcion: ~LineaTiempoGrafo (Destructor)
+    Descripcion: Libera los eventos y las series.
+    Complejidad: O(1)
+*/
+LineaTiempoGrafo::~LineaTiempoGrafo() {
+    limpiar();
+}
+
+/*
+    funcion: limpiar
+    Descripcion: Descarta los eventos registrados y las series construidas.
+    Complejidad: O(1)
+*/
+void LineaTiempoGrafo::limpiar() {
+    delete[] eventosPlatillo;
+    delete[] eventosRestaurante;
+    delete[] eventosDia;
+    eventosPlatillo = nullptr;
+    eventosRestaurante = nullptr;
+    eventosDia = nullptr;
+    numEventos = 0;
+    capacidadEventos = 0;
+    liberarSeries();
+}
+
+/*
+    funcion: liberarSeries
+    Descripcion: Libera sólo las series construidas (los eventos se conservan para poder
+                 reconstruir cuando lleguen más pedidos).
+    Complejidad: O(1)
+*/
+void LineaTiempoGrafo::liberarSeries() {
+    delete[] offsets;
+    delete[] vecinos;
+    delete[] inicioSerie;
+    delete[] dias;
+    delete[] acumulados;
+    offsets = nullptr;
+    vecinos = nullptr;
+    inicioSerie = nullptr;
+    dias = nullptr;
+    acumulados = nullptr;
+    numNodos = 0;
+    numAristas = 0;
+}
+
+/*
+    funcion: estaConstruida
+    Descripcion: Indica si ya se construyeron las series.
+    Return: true si se pueden hacer consultas
+    Complejidad: O(1)
+*/
+bool LineaTiempoGrafo::estaConstruida() const {
+    return offsets != nullptr;
+}
+
+/*
+    funcion: registrarPedido
+    Descripcion: Guarda un pedido del platillo en el restaurante en el día dado. Los
+                 arreglos de eventos crecen al doble cuando se llenan.
+    Parametros:
+        - idPlatillo: ID del platillo en el grafo
+        - idRestaurante: ID del restaurante en el grafo
+        - dia: Día del pedido
+    Complejidad: O(1) amortizado
+*/
+void LineaTiempoGrafo::registrarPedido(int idPlatillo, int idRestaurante, int dia) {
+    if (numEventos == capacidadEventos) {
+        const int nuevaCapacidad = (capacidadEventos == 0) ? 1024 : capacidadEventos * 2;
+        int* nuevosPlatillos = new int[nuevaCapacidad];
+        int* nuevosRestaurantes = new int[nuevaCapacidad];
+        int* nuevosDias = new int[nuevaCapacidad];
+        for (int i = 0; i < numEventos; ++i) {
+            nuevosPlatillos[i] = eventosPlatillo[i];
+            nuevosRestaurantes[i] = eventosRestaurante[i];
+            nuevosDias[i] = eventosDia[i];
+        }
+        delete[] eventosPlatillo;
+        delete[] eventosRestaurante;
+        delete[] eventosDia;
+        eventosPlatillo = nuevosPlatillos;
+        eventosRestaurante = nuevosRestaurantes;
+        eventosDia = nuevosDias;
+        capacidadEventos = nuevaCapacidad;
+    }
+
+    eventosPlatillo[numEventos] = idPlatillo;
+    eventosRestaurante[numEventos] = idRestaurante;
+    eventosDia[numEventos] = dia;
+    numEventos++;
+}
+
+/*
+    funcion: ordenarPorLlave
+    Descripcion: Counting sort estable de una permutación según una llave entera en
+                 [0, numLlaves).
+    Parametros:
+        - orden: Permutación a ordenar (se sobrescribe con el resultado)
+        - temporal: Arreglo auxiliar del mismo tamaño
+        - llaves: Llave de cada elemento
+        - n: Número de elementos
+        - numLlaves: Rango de las llaves
+        - cuentas: Arreglo auxiliar de numLlaves + 1 enteros
+    Complejidad: O(n + numLlaves)
+*/
+static void ordenarPorLlave(int* orden, int* temporal, const int* llaves, int n, int numLlaves, int* cuentas) {
+    for (int i = 0; i <= numLlaves; ++i) {
+        cuentas[i] = 0;
+    }
+    for (int i = 0; i < n; ++i) {
+        cuentas[llaves[orden[i]] + 1]++;
+    }
+    for (int i = 0; i < numLlaves; ++i) {
+        cuentas[i + 1] += cuentas[i];
+    }
+    for (int i = 0; i < n; ++i) {
+        temporal[cuentas[llaves[orden[i]]]++] = orden[i];
+    }
+    for (int i = 0; i < n; ++i) {
+        orden[i] = temporal[i];
+    }
+}
+
+/*
+    funcion: construir
+    Descripcion: Convierte los eventos registrados en series por arista.
+
+    ALGORITMO:
+    1. Duplicar cada evento en sus dos direcciones (platillo -> restaurante y al revés)
+    2. Ordenar con counting sort estable (radix LSD): por día, luego por destino y al
+       final por origen. Queda ordenado por (origen, destino, día) en O(eventos + V)
+    3. Un recorrido agrupa las aristas y, dentro de cada una, los días iguales, guardando
+       los pedidos acumulados
+
+    Se puede volver a llamar después de registrar más pedidos.
+
+    Parametros:
+        - numNodos: Número de nodos del grafo (todos los IDs registrados son menores)
+    Complejidad: O(eventos + V)
+*/
+void LineaTiempoGrafo::construir(int numNodos) {
+    liberarSeries();
+    this->numNodos = numNodos;
+
+    const int m = 2 * numEventos;
+    int* origen = new int[m > 0 ? m : 1];
+    int* destino = new int[m > 0 ? m : 1];
+    int* dia = new int[m > 0 ? m : 1];
+    for (int i = 0; i < numEventos; ++i) {
+        origen[2 * i] = eventosPlatillo[i];
+        destino[2 * i] = eventosRestaurante[i];
+        origen[2 * i + 1] = eventosRestaurante[i];
+        destino[2 * i + 1] = eventosPlatillo[i];
+        dia[2 * i] = eventosDia[i];
+        dia[2 * i + 1] = eventosDia[i];
+    }
+
+    // Días relativos al menor, partidos en dos dígitos de 16 bits para el radix
+    int diaMinimo = 0;
+    int diaMaximo = 0;
+    for (int i = 0; i < m; ++i) {
+        if (i == 0 || dia[i] < diaMinimo) diaMinimo = dia[i];
+        if (i == 0 || dia[i] > diaMaximo) diaMaximo = dia[i];
+    }
+    const unsigned int rangoDias = static_cast<unsigned int>(diaMaximo) - static_cast<unsigned int>(diaMinimo);
+    int* digito = new int[m > 0 ? m : 1];
+
+    int* orden = new int[m > 0 ? m : 1];
+    int* temporal = new int[m > 0 ? m : 1];
+    const int BASE = 1 << 16;
+    const int maxLlaves = (numNodos > BASE) ? numNodos : BASE;
+    int* cuentas = new int[maxLlaves + 1];
+    for (int i = 0; i < m; ++i) {
+        orden[i] = i;
+    }
+
+    for (int i = 0; i < m; ++i) {
+        digito[i] = static_cast<int>((static_cast<unsigned int>(dia[i]) - static_cast<unsigned int>(diaMinimo)) & (BASE - 1));
+    }
+    ordenarPorLlave(orden, temporal, digito, m, BASE, cuentas);
+    if (rangoDias >= static_cast<unsigned int>(BASE)) {
+        for (int i = 0; i < m; ++i) {
+            digito[i] = static_cast<int>((static_cast<unsigned int>(dia[i]) - static_cast<unsigned int>(diaMinimo)) >> 16);
+        }
+        ordenarPorLlave(orden, temporal, digito, m, BASE, cuentas);
+    }
+    ordenarPorLlave(orden, temporal, destino, m, numNodos, cuentas);
+    ordenarPorLlave(orden, temporal, origen, m, numNodos, cuentas);
+
+    // Agrupar aristas y días
+    offsets = new int[numNodos + 1];
+    vecinos = new int[m > 0 ? m : 1];
+    inicioSerie = new int[m + 1];
+    dias = new int[m > 0 ? m : 1];
+    acumulados = new int[m > 0 ? m : 1];
+    for (int i = 0; i <= numNodos; ++i) {
+        offsets[i] = 0;
+    }
+
+    int numDias = 0;
+    for (int i = 0; i < m; ++i) {
+        const int e = orden[i];
+        const bool aristaNueva = (i == 0) || origen[e] != origen[orden[i - 1]] || destino[e] != destino[orden[i - 1]];
+        if (aristaNueva) {
+            vecinos[numAristas] = destino[e];
+            inicioSerie[numAristas] = numDias;
+            offsets[origen[e] + 1]++;
+            numAristas++;
+            dias[numDias] = dia[e];
+            acumulados[numDias] = 1;
+            numDias++;
+        } else if (dia[e] != dias[numDias - 1]) {
+            dias[numDias] = dia[e];
+            acumulados[numDias] = acumulados[numDias - 1] + 1;
+            numDias++;
+        } else {
+            acumulados[numDias - 1]++;
+        }
+    }
+    inicioSerie[numAristas] = numDias;
+    for (int i = 0; i < numNodos; ++i) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    delete[] origen;
+    delete[] destino;
+    delete[] dia;
+    delete[] digito;
+    delete[] orden;
+    delete[] temporal;
+    delete[] cuentas;
+}
+
+/*
+    funcion: pedidosHasta
+    Descripcion: Pedidos de una arista desde el inicio hasta el día dado, inclusive
+                 (búsqueda binaria del último día <= dia).
+    Parametros:
+        - arista: Índice de la arista
+        - dia: Día límite
+    Return: Pedidos acumulados
+    Complejidad: O(log D), D = días con pedidos de la arista
+*/
+int LineaTiempoGrafo::pedidosHasta(int arista, int dia) const {
+    int bajo = inicioSerie[arista];
+    int alto = inicioSerie[arista + 1];
+    while (bajo < alto) {
+        const int medio = bajo + (alto - bajo) / 2;
+        if (dias[medio] <= dia) bajo = medio + 1;
+        else alto = medio;
+    }
+    return (bajo == inicioSerie[arista]) ? 0 : acumulados[bajo - 1];
+}
+
+/*
+    funcion: pesoDeArista
+    Descripcion: Pedidos de una arista dentro de [diaInicio, diaFin].
+    Parametros:
+        - arista: Índice de la arista
+        - diaInicio, diaFin: Rango de días (inclusive)
+    Return: Pedidos en el rango
+    Complejidad: O(log D)
+*/
+int LineaTiempoGrafo::pesoDeArista(int arista, int diaInicio, int diaFin) const {
+    if (diaInicio > diaFin) return 0;
+    return pedidosHasta(arista, diaFin) - pedidosHasta(arista, diaInicio - 1);
+}
+
+/*
+    funcion: vecinosEnVentana
+    Descripcion: Vecinos de un nodo con al menos un pedido dentro del rango de días,
+                 con sus pedidos en el rango (ej. qué restaurantes vendieron un platillo
+                 la semana pasada).
+    Parametros:
+        - nodo: ID del nodo
+        - diaInicio, diaFin: Rango de días (inclusive)
+        - vecinosEnRango: Buffer para los IDs de los vecinos (ordenados por ID)
+        - pesosEnRango: Buffer paralelo para los pedidos en el rango
+        - capacidad: Tamaño de los buffers
+    Return: Número de vecinos escritos
+    Complejidad: O(grado * log D)
+*/
+int LineaTiempoGrafo::vecinosEnVentana(int nodo, int diaInicio, int diaFin, int* vecinosEnRango, int* pesosEnRango, int capacidad) const {
+    if (!estaConstruida() || nodo < 0 || nodo >= numNodos) return 0;
+
+    int cuenta = 0;
+    for (int k = offsets[nodo]; k < offsets[nodo + 1] && cuenta < capacidad; ++k) {
+        const int peso = pesoDeArista(k, diaInicio, diaFin);
+        if (peso == 0) continue;
+        vecinosEnRango[cuenta] = vecinos[k];
+        pesosEnRango[cuenta] = peso;
+        cuenta++;
+    }
+    return cuenta;
+}
+
+/*
+    funcion: construirVentana
+    Descripcion: Arma el grafo de un rango de días en forma CSR: mismas IDs de nodo que el
+                 Graph, sólo las aristas con pedidos en el rango y con esos pedidos como
+                 peso. El resultado se puede recorrer con Graph::calcularNivelesBFS.
+    Parametros:
+        - diaInicio, diaFin: Rango de días (inclusive)
+        - destino: CSR que recibe el subgrafo (reutiliza su memoria si alcanza)
+    Complejidad: O(V + E * log D)
+*/
+void LineaTiempoGrafo::construirVentana(int diaInicio, int diaFin, GrafoCSR& destino) const {
+    // Primera pasada: pesos en el rango, para saber cuántas aristas quedan
+    int* pesos = new int[numAristas > 0 ? numAristas : 1];
+    int total = 0;
+    for (int k = 0; k < numAristas; ++k) {
+        pesos[k] = pesoDeArista(k, diaInicio, diaFin);
+        if (pesos[k] > 0) total++;
+    }
+
+    destino.reservar(numNodos, total);
+    int posicion = 0;
+    for (int i = 0; i < numNodos; ++i) {
+        destino.offsets[i] = posicion;
+        for (int k = offsets[i]; k < offsets[i + 1]; ++k) {
+            if (pesos[k] == 0) continue;
+            destino.vecinos[posicion] = vecinos[k];
+            destino.pesos[posicion] = pesos[k];
+            posicion++;
+        }
+    }
+    destino.offsets[numNodos] = posicion;
+
+    delete[] pesos;
+}
@@ -0,0 +1,300 @@
+#include "MatrizMenus.hpp"
+#include "Hilos.hpp"
+#include "Bits.hpp"
+#include "TopK.hpp"
+#include <atomic>
+#include <iostream>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define MATRIZ_MENUS_AVX2 1
+#endif
+
+typedef int (*FuncionInterseccion)(const unsigned long long* a, const unsigned long long* b, int palabras);
+
+/*
+    funcion: interseccionEscalar
+    Descripcion: Cuenta los bits en común de dos filas, 64 bits a la vez.
+    Parametros:
+        - a, b: Filas de la matriz
+        - palabras: Palabras de 64 bits por fila
+    Return: popcount(a AND b)
+    Complejidad: O(palabras)
+*/
+static int interseccionEscalar(const unsigned long long* a, const unsigned long long* b, int palabras) {
+    int total = 0;
+    for (int i = 0; i < palabras; ++i) {
+        total += contarBits(a[i] & b[i]);
+    }
+    return total;
+}
+
+#ifdef MATRIZ_MENUS_AVX2
+/*
+    funcion: interseccionAVX2
+    Descripcion: Igual que interseccionEscalar pero 256 bits a la vez. El popcount de cada
+                 byte sale de dos búsquedas en una tabla de 16 entradas (una por nibble) con
+                 vpshufb, y vpsadbw suma los bytes en 4 contadores de 64 bits.
+                 Se compila con target("avx2") para no exigir -mavx2 a todo el programa;
+                 sólo se llama si el procesador soporta AVX2.
+    Parametros:
+        - a, b: Filas de la matriz
+        - palabras: Palabras de 64 bits por fila (múltiplo de 4)
+    Return: popcount(a AND b)
+    Complejidad: O(palabras / 4)
+*/
+__attribute__((target("avx2")))
+static int interseccionAVX2(const unsigned long long* a, const unsigned long long* b, int palabras) {
+    const __m256i tabla = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    const __m256i cero = _mm256_setzero_si256();
+    __m256i total = cero;
+
+    for (int i = 0; i < palabras; i += 4) {
+        const __m256i filaA = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i filaB = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i comun = _mm256_and_si256(filaA, filaB);
+        const __m256i bajos = _mm256_shuffle_epi8(tabla, _mm256_and_si256(comun, nibble));
+        const __m256i altos = _mm256_shuffle_epi8(tabla, _mm256_and_si256(_mm256_srli_epi16(comun, 4), nibble));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(bajos, altos), cero));
+    }
+
+    return static_cast<int>(_mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1)
+                            + _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3));
+}
+#endif
+
+/*
+    funcion: elegirInterseccion
+    Descripcion: Elige una sola vez el kernel de intersección según el procesador.
+                 Corre antes de main, por eso llama a __builtin_cpu_init.
+    Return: Puntero al kernel AVX2 si está disponible, si no al escalar
+    Complejidad: O(1)
+*/
+static FuncionInterseccion elegirInterseccion() {
+#ifdef MATRIZ_MENUS_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return interseccionAVX2;
+#endif
+    return interseccionEscalar;
+}
+
+static const FuncionInterseccion interseccionRapida = elegirInterseccion();
+
+/*
+    funcion: MatrizMenus (Constructor)
+    Descripcion: Inicializa una matriz vacía (sin construir).
+    Complejidad: O(1)
+*/
+MatrizMenus::MatrizMenus()
+    : numNodos(0), numFilas(0), palabrasPorFila(0), bits(nullptr), tamanos(nullptr),
+      filaDeNodo(nullptr), nodoDeFila(nullptr) {
+}
+
+/*
+    funcion: ~MatrizMenus (Destructor)
+    Descripcion: Libera la matriz.
+    Complejidad: O(1)
+*/
+MatrizMenus::~MatrizMenus() {
+    limpiar();
+}
+
+/*
+    funcion: limpiar
+    Descripcion: Descarta la matriz construida.
+    Complejidad: O(1)
+*/
+void MatrizMenus::limpiar() {
+    delete[] bits;
+    delete[] tamanos;
+    delete[] filaDeNodo;
+    delete[] nodoDeFila;
+    bits = nullptr;
+    tamanos = nullptr;
+    filaDeNodo = nullptr;
+    nodoDeFila = nullptr;
+    numNodos = 0;
+    numFilas = 0;
+    palabrasPorFila = 0;
+}
+
+/*
+    funcion: construir
+    Descripcion: Arma la matriz de bits a partir del CSR del grafo. Las columnas son los
+                 platillos numerados en orden de ID; cada fila se rellena con ceros hasta
+                 un múltiplo de 256 bits para que el kernel AVX2 no tenga residuo.
+    Parametros:
+        - grafo: Grafo Platillo-Restaurante
+    Complejidad: O(V + E + R * P / 64)
+*/
+void MatrizMenus::construir(const Graph& grafo) {
+    limpiar();
+
+    const GrafoCSR& g = grafo.obtenerCSR();
+    numNodos = grafo.getNumNodos();
+    filaDeNodo = new int[numNodos > 0 ? numNodos : 1];
+    int* columnaDeNodo = new int[numNodos > 0 ? numNodos : 1];
+
+    int numColumnas = 0;
+    for (int i = 0; i < numNodos; ++i) {
+        filaDeNodo[i] = -1;
+        columnaDeNodo[i] = -1;
+        if (grafo.getTipoNodo(i) == 'R') {
+            filaDeNodo[i] = numFilas++;
+        } else {
+            columnaDeNodo[i] = numColumnas++;
+        }
+    }
+
+    const int palabras = (numColumnas + 63) / 64;
+    palabrasPorFila = (palabras + PALABRAS_POR_BLOQUE - 1) / PALABRAS_POR_BLOQUE * PALABRAS_POR_BLOQUE;
+    const long long totalPalabras = static_cast<long long>(numFilas) * palabrasPorFila;
+    bits = new Palabra[totalPalabras > 0 ? totalPalabras : 1];
+    tamanos = new int[numFilas > 0 ? numFilas : 1];
+    nodoDeFila = new int[numFilas > 0 ? numFilas : 1];
+    for (long long i = 0; i < totalPalabras; ++i) {
+        bits[i] = 0;
+    }
+
+    for (int nodo = 0; nodo < numNodos; ++nodo) {
+        const int fila = filaDeNodo[nodo];
+        if (fila == -1) continue;
+        nodoDeFila[fila] = nodo;
+        tamanos[fila] = 0;
+
+        Palabra* datos = bits + static_cast<long long>(fila) * palabrasPorFila;
+        for (int k = g.offsets[nodo]; k < g.offsets[nodo + 1]; ++k) {
+            const int columna = columnaDeNodo[g.vecinos[k]];
+            if (columna == -1) continue;
+            datos[columna >> 6] |= 1ULL << (columna & 63);
+            tamanos[fila]++;
+        }
+    }
+
+    delete[] columnaDeNodo;
+}
+
+/*
+    funcion: interseccion
+    Descripcion: Platillos en común de dos filas.
+    Parametros:
+        - filaA, filaB: Filas de la matriz
+    Return: Tamaño de la intersección
+    Complejidad: O(P / 256) con AVX2, O(P / 64) sin él
+*/
+int MatrizMenus::interseccion(int filaA, int filaB) const {
+    return interseccionRapida(bits + static_cast<long long>(filaA) * palabrasPorFila,
+                              bits + static_cast<long long>(filaB) * palabrasPorFila,
+                              palabrasPorFila);
+}
+
+/*
+    funcion: esMasParecido
+    Descripcion: Orden de los pares: mayor similitud, luego más platillos compartidos y,
+                 en empate, menores IDs (para que el resultado no dependa de los hilos).
+    Parametros:
+        - a, b: Pares a comparar
+    Return: true si 'a' va antes que 'b'
+    Complejidad: O(1)
+*/
+bool MatrizMenus::esMasParecido(const ParRestaurantes& a, const ParRestaurantes& b) {
+    if (a.similitud != b.similitud) return a.similitud > b.similitud;
+    if (a.compartidos != b.compartidos) return a.compartidos > b.compartidos;
+    if (a.restauranteA != b.restauranteA) return a.restauranteA < b.restauranteA;
+    return a.restauranteB < b.restauranteB;
+}
+
+/*
+    funcion: paresMasParecidos
+    Descripcion: Compara todos los pares de restaurantes (Jaccard exacto) y se queda con
+                 los más parecidos. Cada hilo toma filas de un contador atómico (la fila i
+                 se compara con las filas j > i, así que las primeras cuestan más) y guarda
+                 su propio top; al final se mezclan los tops.
+    Parametros:
+        - resultado: Buffer para los pares, de más a menos parecido
+        - capacidad: Máximo de pares
+        - numHilos: Hilos a usar; 0 usa todos los núcleos
+    Return: Número de pares escritos (sólo pares con al menos un platillo en común)
+    Complejidad: O(R^2 * P / 256 + R^2 * capacidad / hilos) en el peor caso
+*/
+int MatrizMenus::paresMasParecidos(ParRestaurantes* resultado, int capacidad, int numHilos) const {
+    if (capacidad <= 0 || numFilas < 2) return 0;
+
+    const long long pares = static_cast<long long>(numFilas) * (numFilas - 1) / 2;
+    const int hilos = hilosParaTrabajo(numeroDeHilos(numHilos), pares, 4096);
+    ParRestaurantes* tops = new ParRestaurantes[static_cast<long long>(hilos) * capacidad];
+    int* cuentas = new int[hilos];
+    std::atomic<int> siguienteFila(0);
+
+    ejecutarEnHilos(hilos, [&](int h) {
+        ParRestaurantes* top = tops + static_cast<long long>(h) * capacidad;
+        int enTop = 0;
+
+        while (true) {
+            const int filaA = siguienteFila.fetch_add(1);
+            if (filaA >= numFilas) break;
+            const Palabra* datosA = bits + static_cast<long long>(filaA) * palabrasPorFila;
+
+            for (int filaB = filaA + 1; filaB < numFilas; ++filaB) {
+                const int compartidos = interseccionRapida(datosA, bits + static_cast<long long>(filaB) * palabrasPorFila,
+                                                           palabrasPorFila);
+                if (compartidos == 0) continue;
+
+                ParRestaurantes candidato;
+                candidato.restauranteA = nodoDeFila[filaA];
+                candidato.restauranteB = nodoDeFila[filaB];
+                candidato.compartidos = compartidos;
+                candidato.similitud = static_cast<float>(compartidos)
+                                      / static_cast<float>(tamanos[filaA] + tamanos[filaB] - compartidos);
+                insertarEnTop(top, enTop, capacidad, candidato, esMasParecido);
+            }
+        }
+        cuentas[h] = enTop;
+    });
+
+    int cuenta = 0;
+    for (int h = 0; h < hilos; ++h) {
+        const ParRestaurantes* top = tops + static_cast<long long>(h) * capacidad;
+        for (int i = 0; i < cuentas[h]; ++i) {
+            insertarEnTop(resultado, cuenta, capacidad, top[i], esMasParecido);
+        }
+    }
+
+    delete[] tops;
+    delete[] cuentas;
+    return cuenta;
+}
+
+/*
+    funcion: imprimirParesMasParecidos
+    Descripcion: Muestra los pares de restaurantes con los menús más parecidos.
+    Parametros:
+        - grafo: Grafo con el que se construyó la matriz
+        - n: Máximo de pares a mostrar
+    Complejidad: La de paresMasParecidos
+*/
+void MatrizMenus::imprimirParesMasParecidos(const Graph& grafo, int n) const {
+    if (n <= 0) {
+        std::cout << "El número de pares debe ser mayor que 0." << std::endl;
+        return;
+    }
+
+    ParRestaurantes* pares = new ParRestaurantes[n];
+    const int cuenta = paresMasParecidos(pares, n);
+
+    std::cout << "\n===== Restaurantes con los menús más parecidos =====" << std::endl;
+    if (cuenta == 0) {
+        std::cout << "  (ningún par de restaurantes comparte platillos)" << std::endl;
+    }
+    for (int i = 0; i < cuenta; ++i) {
+        std::cout << "  " << i + 1 << ". " << grafo.getNombreNodo(pares[i].restauranteA)
+                  << "<-> " << grafo.getNombreNodo(pares[i].restauranteB)
+                  << "- " << pares[i].compartidos << " platillos en común"
+                  << " (similitud " << pares[i].similitud << ")" << std::endl;
+    }
+    std::cout << "====================================================" << std::endl;
+
+    delete[] pares;
+}
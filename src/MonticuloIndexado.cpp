@@ -0,0 +1,184 @@
+#include "MonticuloIndexado.hpp"
+
+/*
+    funcion: MonticuloIndexado (Constructor)
+    Descripcion: Inicializa un montículo sin capacidad.
+    Complejidad: O(1)
+*/
+MonticuloIndexado::MonticuloIndexado() : ids(nullptr), claves(nullptr), posicion(nullptr), tamano(0), capacidad(0) {
+}
+
+/*
+    funcion: ~MonticuloIndexado (Destructor)
+    Descripcion: Libera los arreglos del montículo.
+    Complejidad: O(1)
+*/
+MonticuloIndexado::~MonticuloIndexado() {
+    delete[] ids;
+    delete[] claves;
+    delete[] posicion;
+}
+
+/*
+    funcion: reservar
+    Descripcion: Garantiza espacio para IDs de 0 a nuevaCapacidad - 1. Si ya alcanza no hace
+                 nada; si no, vacía el montículo y crece los arreglos.
+    Parametros:
+        - nuevaCapacidad: Número de IDs distintos que se van a insertar
+    Complejidad: O(1) si ya alcanza, O(nuevaCapacidad) si crece
+*/
+void MonticuloIndexado::reservar(int nuevaCapacidad) {
+    if (nuevaCapacidad <= capacidad) return;
+
+    delete[] ids;
+    delete[] claves;
+    delete[] posicion;
+    ids = new int[nuevaCapacidad];
+    claves = new double[nuevaCapacidad];
+    posicion = new int[nuevaCapacidad];
+    for (int i = 0; i < nuevaCapacidad; ++i) {
+        posicion[i] = -1;
+    }
+    capacidad = nuevaCapacidad;
+    tamano = 0;
+}
+
+/*
+    funcion: vaciar
+    Descripcion: Quita todos los elementos. Sólo toca los IDs que seguían en el montículo.
+    Complejidad: O(tamaño)
+*/
+void MonticuloIndexado::vaciar() {
+    for (int i = 0; i < tamano; ++i) {
+        posicion[ids[i]] = -1;
+    }
+    tamano = 0;
+}
+
+/*
+    funcion: vacio
+    Descripcion: Indica si el montículo no tiene elementos.
+    Return: true si está vacío
+    Complejidad: O(1)
+*/
+bool MonticuloIndexado::vacio() const {
+    return tamano == 0;
+}
+
+/*
+    funcion: getTamano
+    Descripcion: Número de elementos en el montículo.
+    Return: Tamaño actual
+    Complejidad: O(1)
+*/
+int MonticuloIndexado::getTamano() const {
+    return tamano;
+}
+
+/*
+    funcion: contiene
+    Descripcion: Indica si un ID está en el montículo.
+    Parametros:
+        - id: ID a consultar (0 a capacidad - 1)
+    Return: true si está
+    Complejidad: O(1)
+*/
+bool MonticuloIndexado::contiene(int id) const {
+    return posicion[id] != -1;
+}
+
+/*
+    funcion: insertarOReducir
+    Descripcion: Inserta un ID con la clave dada o, si ya está, baja su clave cuando la
+                 nueva es menor (una clave mayor se ignora).
+    Parametros:
+        - id: ID a insertar (0 a capacidad - 1)
+        - clave: Prioridad (menor sale primero)
+    Complejidad: O(log n)
+*/
+void MonticuloIndexado::insertarOReducir(int id, double clave) {
+    int i = posicion[id];
+    if (i == -1) {
+        i = tamano++;
+        colocar(i, id, clave);
+    } else if (clave < claves[i]) {
+        claves[i] = clave;
+    } else {
+        return;
+    }
+    subir(i);
+}
+
+/*
+    funcion: extraerMinimo
+    Descripcion: Saca el ID con la clave más pequeña. El montículo no debe estar vacío.
+    Return: ID extraído
+    Complejidad: O(log n)
+*/
+int MonticuloIndexado::extraerMinimo() {
+    const int minimo = ids[0];
+    posicion[minimo] = -1;
+    tamano--;
+    if (tamano > 0) {
+        colocar(0, ids[tamano], claves[tamano]);
+        bajar(0);
+    }
+    return minimo;
+}
+
+/*
+    funcion: claveMinima
+    Descripcion: Clave del elemento en la cima. El montículo no debe estar vacío.
+    Return: Clave mínima
+    Complejidad: O(1)
+*/
+double MonticuloIndexado::claveMinima() const {
+    return claves[0];
+}
+
+/*
+    funcion: colocar
+    Descripcion: Escribe un ID y su clave en la posición i y actualiza el índice inverso.
+    Complejidad: O(1)
+*/
+void MonticuloIndexado::colocar(int i, int id, double clave) {
+    ids[i] = id;
+    claves[i] = clave;
+    posicion[id] = i;
+}
+
+/*
+    funcion: subir
+    Descripcion: Sube el elemento de la posición i mientras su clave sea menor que la de su padre.
+    Complejidad: O(log n)
+*/
+void MonticuloIndexado::subir(int i) {
+    const int id = ids[i];
+    const double clave = claves[i];
+    while (i > 0) {
+        const int padre = (i - 1) / 2;
+        if (claves[padre] <= clave) break;
+        colocar(i, ids[padre], claves[padre]);
+        i = padre;
+    }
+    colocar(i, id, clave);
+}
+
+/*
+    funcion: bajar
+    Descripcion: Baja el elemento de la posición i mientras algún hijo tenga clave menor.
+    Complejidad: O(log n)
+*/
+void MonticuloIndexado::bajar(int i) {
+    const int id = ids[i];
+    const double clave = claves[i];
+    while (true) {
+        int hijo = 2 * i + 1;
+        if (hijo >= tamano) break;
+        if (hijo + 1 < tamano && claves[hijo + 1] < claves[hijo]) hijo++;
+        if (clave <= claves[hijo]) break;
+        colocar(i, ids[hijo], claves[hijo]);
+        i = hijo;
+    }
+    colocar(i, id, clave);
+}
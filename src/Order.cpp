@@ -17,6 +17,8 @@ Order::Order() {
     order = "";
     price = 0;
     numberDate = 0;
+    dishId = -1;
+    restaurantId = -1;
 }
 /*
     Created by Gustavo Gonzalez Ramos
@@ -28,11 +30,15 @@ Order::Order() {
         - order (String): Descripción del pedido
         - price (int): Precio del pedido
         - numberDate (long long): Representación numérica de la fecha para ordenamiento
+        - dishId (int): Índice del platillo en el catálogo (-1 si no se conoce)
+        - restaurantId (int): Índice del restaurante en el catálogo (-1 si no se conoce)
     Return: N/A
     Complejidad: O(1)
 */
-Order::Order(String date, String restaurant, String order, int price, long long numberDate)
-    : date(date), restaurant(restaurant), order(order), price(price),numberDate(numberDate) {
+Order::Order(String date, String restaurant, String order, int price, long long numberDate,
+             int dishId, int restaurantId)
+    : date(date), restaurant(restaurant), order(order), numberDate(numberDate), price(price),
+      dishId(static_cast<short>(dishId)), restaurantId(static_cast<short>(restaurantId)) {
    
 }
 
@@ -96,6 +102,28 @@ long long Order::getNumberDate() const{
     return this -> numberDate;
 }
 
+/*
+    funcion: getDishId
+    Descripcion: Obtiene el índice del platillo en el catálogo de OrderManager
+    Parametros: Ninguno
+    Return: (int) Índice del platillo, -1 si no se conoce
+    Complejidad: O(1)
+*/
+int Order::getDishId() const{
+    return this -> dishId;
+}
+
+/*
+    funcion: getRestaurantId
+    Descripcion: Obtiene el índice del restaurante en el catálogo de OrderManager
+    Parametros: Ninguno
+    Return: (int) Índice del restaurante, -1 si no se conoce
+    Complejidad: O(1)
+*/
+int Order::getRestaurantId() const{
+    return this -> restaurantId;
+}
+
 // Operadores "<>" Sobrecargados
 
 bool Order::operator<(const Order Orden1) const {
@@ -0,0 +1,195 @@
+#include "OrderColumns.hpp"
+
+/*
+    funcion: OrderColumns (Constructor)
+    Descripcion: Inicializa un almacén columnar vacío.
+    Complejidad: O(1)
+*/
+OrderColumns::OrderColumns()
+    : timestamps(nullptr), prices(nullptr), restaurantIds(nullptr), dishIds(nullptr), rows(0), capacity(0) {
+}
+
+/*
+    funcion: ~OrderColumns (Destructor)
+    Descripcion: Libera las columnas.
+    Complejidad: O(1)
+*/
+OrderColumns::~OrderColumns() {
+    delete[] timestamps;
+    delete[] prices;
+    delete[] restaurantIds;
+    delete[] dishIds;
+}
+
+/*
+    funcion: build
+    Descripcion: Copia los campos numéricos de las órdenes a sus columnas. Reutiliza la
+                 memoria si ya alcanza.
+    Parametros:
+        - orders (const Order*): Órdenes ordenadas por numberDate.
+        - count (int): Número de órdenes.
+    Return: N/A
+    Complejidad: O(n)
+*/
+void OrderColumns::build(const Order* orders, int count) {
+    if (count > capacity) {
+        delete[] timestamps;
+        delete[] prices;
+        delete[] restaurantIds;
+        delete[] dishIds;
+        timestamps = new long long[count];
+        prices = new int[count];
+        restaurantIds = new int[count];
+        dishIds = new int[count];
+        capacity = count;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        timestamps[i] = orders[i].getNumberDate();
+        prices[i] = orders[i].getPrice();
+        restaurantIds[i] = orders[i].getRestaurantId();
+        dishIds[i] = orders[i].getDishId();
+    }
+    rows = count;
+}
+
+/*
+    funcion: clear
+    Descripcion: Vacía el almacén sin liberar la memoria.
+    Complejidad: O(1)
+*/
+void OrderColumns::clear() {
+    rows = 0;
+}
+
+/*
+    funcion: size
+    Descripcion: Número de filas (órdenes).
+    Return: (int) Filas almacenadas
+    Complejidad: O(1)
+*/
+int OrderColumns::size() const {
+    return rows;
+}
+
+/*
+    funcion: getTimestamp
+    Descripcion: Fecha numérica de la fila dada (0 <= row < size()).
+    Complejidad: O(1)
+*/
+long long OrderColumns::getTimestamp(int row) const {
+    return timestamps[row];
+}
+
+/*
+    funcion: priceColumn / restaurantColumn
+    Descripcion: Columna completa (size() elementos) para los recorridos vectorizados.
+    Complejidad: O(1)
+*/
+const int* OrderColumns::priceColumn() const {
+    return prices;
+}
+
+const int* OrderColumns::restaurantColumn() const {
+    return restaurantIds;
+}
+
+/*
+    funcion: lowerBound
+    Descripcion: Primera fila con fecha >= timestamp (búsqueda binaria sobre la columna de fechas).
+    Parametros:
+        - timestamp (long long): Fecha numérica buscada.
+    Return: (int) Índice de la fila, size() si todas son menores
+    Complejidad: O(log n)
+*/
+int OrderColumns::lowerBound(long long timestamp) const {
+    int low = 0;
+    int high = rows;
+    while (low < high) {
+        const int mid = low + (high - low) / 2;
+        if (timestamps[mid] < timestamp) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+/*
+    funcion: upperBound
+    Descripcion: Primera fila con fecha > timestamp.
+    Parametros:
+        - timestamp (long long): Fecha numérica buscada.
+    Return: (int) Índice de la fila, size() si ninguna es mayor
+    Complejidad: O(log n)
+*/
+int OrderColumns::upperBound(long long timestamp) const {
+    int low = 0;
+    int high = rows;
+    while (low < high) {
+        const int mid = low + (high - low) / 2;
+        if (timestamps[mid] <= timestamp) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+/*
+    funcion: aggregate
+    Descripcion: Conteo, suma, mínimo y máximo de precios de las filas [first, last).
+                 Sólo lee la columna de precios.
+    Parametros:
+        - first, last (int): Rango de filas.
+    Return: (OrderAggregate) Resumen del rango
+    Complejidad: O(last - first)
+*/
+OrderAggregate OrderColumns::aggregate(int first, int last) const {
+    OrderAggregate result = {0, 0, 0, 0};
+    if (first >= last) return result;
+
+    long long revenue = 0;
+    int minPrice = prices[first];
+    int maxPrice = prices[first];
+    for (int i = first; i < last; ++i) {
+        const int price = prices[i];
+        revenue += price;
+        if (price < minPrice) minPrice = price;
+        if (price > maxPrice) maxPrice = price;
+    }
+    result.count = last - first;
+    result.revenue = revenue;
+    result.minPrice = minPrice;
+    result.maxPrice = maxPrice;
+    return result;
+}
+
+/*
+    funcion: revenueByRestaurant
+    Descripcion: Suma los precios de [first, last) por restaurante. Lee las columnas de
+                 precio y restaurante.
+    Parametros:
+        - first, last (int): Rango de filas.
+        - revenue (long long*): Acumulador por índice de restaurante; debe venir en 0 y
+                                tener espacio para todos los restaurantes.
+    Return: N/A
+    Complejidad: O(last - first)
+*/
+void OrderColumns::revenueByRestaurant(int first, int last, long long* revenue) const {
+    for (int i = first; i < last; ++i) {
+        if (restaurantIds[i] >= 0) revenue[restaurantIds[i]] += prices[i];
+    }
+}
+
+/*
+    funcion: ordersByDish
+    Descripcion: Cuenta las órdenes de [first, last) por platillo. Sólo lee la columna de platillos.
+    Parametros:
+        - first, last (int): Rango de filas.
+        - counts (int*): Contador por índice de platillo; debe venir en 0 y tener espacio
+                         para todos los platillos.
+    Return: N/A
+    Complejidad: O(last - first)
+*/
+void OrderColumns::ordersByDish(int first, int last, int* counts) const {
+    for (int i = first; i < last; ++i) {
+        if (dishIds[i] >= 0) counts[dishIds[i]]++;
+    }
+}
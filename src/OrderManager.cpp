@@ -11,11 +11,118 @@
     Created by Gustavo Gonzalez Ramos 
     funcion: OrderManager (Constructor)
     Descripcion: Inicializa un objeto OrderManager con un contador de órdenes en 0
+                 y una franja por cada hora del día
     Parametros: Ninguno
     Return: N/A
     Complejidad: O(1)
 */
 OrderManager::OrderManager() : orderCount(0) {  
+    for (int h = 0; h < HOURS_PER_DAY; ++h) {
+        hourSlots[h] = HourSlot(h);
+    }
+}
+
+/*
+    funcion: ~OrderManager (Destructor)
+    Descripcion: Libera el catálogo de restaurantes y los arreglos auxiliares que crecen
+                 con los catálogos.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(r)
+*/
+OrderManager::~OrderManager() {
+    delete[] restaurants;
+    delete[] rankingBuffer;
+    delete[] dishNodeIds;
+    delete[] restaurantNodeIds;
+    delete[] nodeCatalogIds;
+}
+
+/*
+    funcion: growNodeIds
+    Descripcion: Asegura que un mapa índice de catálogo -> vértice del grafo tenga al menos
+                 needed casillas, duplicando su tamaño; las casillas nuevas quedan en -1.
+    Parametros:
+        - ids (int*&): Mapa a crecer.
+        - capacity (int&): Tamaño actual del mapa.
+        - needed (int): Casillas necesarias.
+    Return: N/A
+    Complejidad: O(1) amortizado
+*/
+static void growNodeIds(int*& ids, int& capacity, int needed) {
+    if (needed <= capacity) return;
+    int newCapacity = capacity > 0 ? capacity : 64;
+    while (newCapacity < needed) newCapacity *= 2;
+    int* grown = new int[newCapacity];
+    for (int i = 0; i < capacity; ++i) grown[i] = ids[i];
+    for (int i = capacity; i < newCapacity; ++i) grown[i] = -1;
+    delete[] ids;
+    ids = grown;
+    capacity = newCapacity;
+}
+
+/*
+    funcion: linkCatalogNode
+    Descripcion: Enlaza una entrada de catálogo con su vértice en el grafo en ambos
+                 sentidos: catálogo -> vértice para agregar aristas y vértice -> catálogo
+                 para que buscar un nombre sea una consulta al índice hash del grafo.
+    Parametros:
+        - catalogNodeIds (int*&): Mapa catálogo -> vértice del tipo de la entrada.
+        - catalogNodeIdsCapacity (int&): Tamaño de ese mapa.
+        - index (int): Índice de la entrada en su catálogo.
+        - node (int): ID del vértice.
+    Return: N/A
+    Complejidad: O(1) amortizado
+*/
+void OrderManager::linkCatalogNode(int*& catalogNodeIds, int& catalogNodeIdsCapacity, int index, int node) {
+    growNodeIds(catalogNodeIds, catalogNodeIdsCapacity, index + 1);
+    catalogNodeIds[index] = node;
+    growNodeIds(nodeCatalogIds, nodeCatalogIdsCapacity, node + 1);
+    nodeCatalogIds[node] = index;
+}
+
+/*
+    funcion: catalogIndexOfNode
+    Descripcion: Índice de catálogo de un vértice del grafo.
+    Parametros:
+        - node (int): ID del vértice, -1 si el nombre no se encontró.
+    Return: (int) Índice en el catálogo del tipo del vértice, -1 si no tiene.
+    Complejidad: O(1)
+*/
+int OrderManager::catalogIndexOfNode(int node) const {
+    if (node < 0 || node >= nodeCatalogIdsCapacity) return -1;
+    return nodeCatalogIds[node];
+}
+
+/*
+    funcion: rankingScratch
+    Descripcion: Buffer reutilizable para las consultas de ranking, con espacio para al
+                 menos needed IDs. Sólo se realoja cuando el catálogo creció.
+    Parametros:
+        - needed (int): IDs que debe poder guardar (tamaño del catálogo consultado).
+    Return: (int*) Buffer de rankingBufferCapacity enteros
+    Complejidad: O(1) amortizado
+*/
+int* OrderManager::rankingScratch(int needed) const {
+    if (needed > rankingBufferCapacity) {
+        delete[] rankingBuffer;
+        rankingBufferCapacity = needed > 2 * rankingBufferCapacity ? needed : 2 * rankingBufferCapacity;
+        rankingBuffer = new int[rankingBufferCapacity];
+    }
+    return rankingBuffer;
+}
+
+/*
+    funcion: dayKey
+    Descripcion: Día de una fecha comparable como entero MMDD (ej. 207 para Feb 7), que
+                 conserva el orden cronológico. Es la unidad de la línea de tiempo del grafo.
+    Parametros:
+        - numberDate (long long): Fecha en formato comparable (ver convertToComparableDate)
+    Return: (int) Día en formato MMDD
+    Complejidad: O(1)
+*/
+static int dayKey(long long numberDate) {
+    return static_cast<int>((numberDate / 1000000LL) % 10000LL);
 }
 
 /*
@@ -109,12 +216,11 @@ Order OrderManager::parseLine(String& line) {
 
     long long numberDate = convertToComparableDate(date.c_str());
 
-    if (Dish* dish = findDish(order)) {
-        dish->addOrder();
-    } else {
-        addDish(order);
-    }
-    return {date, restaurant, order, price, numberDate};
+    const int dishIndex = recordDishOrder(order);
+    const int restaurantIndex = recordRestaurantOrder(restaurant, price);
+    recordHourOrder(std::atoi(hour));
+    recordGraphOrder(dishIndex, restaurantIndex, dayKey(numberDate));
+    return {date, restaurant, order, price, numberDate, dishIndex, restaurantIndex};
 }
 
 /*
@@ -122,6 +228,7 @@ Order OrderManager::parseLine(String& line) {
     funcion: findOrder
     Descripcion: Realiza una búsqueda binaria para encontrar una orden por su numberDate.
                  Puede encontrar una coincidencia exacta o la más cercana, y la primera o última en caso de duplicados.
+                 Busca sobre la columna de fechas (orderColumns), que debe estar al día con orders.
     Parametros:
         - val (long long): Número de identificación de la orden (numberDate) a buscar.
         - exact (bool): Si es true, solo devuelve coincidencias exactas. Si es false, devuelve el índice del elemento más cercano.
@@ -131,18 +238,18 @@ Order OrderManager::parseLine(String& line) {
 */
 int OrderManager::findOrder(const long long val,const bool exact = true,const bool last = false) const {
   const int n = orderCount;
-  if (val < orders[0].getNumberDate()) return exact ?  -1 :  0;
-  if (val > orders[n-1].getNumberDate()) return exact ?  -1 :  n;
+  if (val < orderColumns.getTimestamp(0)) return exact ?  -1 :  0;
+  if (val > orderColumns.getTimestamp(n-1)) return exact ?  -1 :  n;
   bool found = false;
   int findIndex = -1;
 
   int low = 0;
   int high = n-1;
   while (low<= high && !found) {
-    if (const int mid = low + (high - low) / 2; orders[mid].getNumberDate() == val) {
+    if (const int mid = low + (high - low) / 2; orderColumns.getTimestamp(mid) == val) {
       found = true;
       findIndex = mid;
-    } else if (orders[mid].getNumberDate() > val) {
+    } else if (orderColumns.getTimestamp(mid) > val) {
       high = mid - 1;
     } else{
       low = mid + 1;
@@ -152,10 +259,10 @@ int OrderManager::findOrder(const long long val,const bool exact = true,const bo
   if (!exact && findIndex == -1) {
     if (low != 0) {
       if (!last) {
-        while (val > orders[low].getNumberDate()) low++;
+        while (val > orderColumns.getTimestamp(low)) low++;
         findIndex = low;
       }else {
-          while (val < orders[low].getNumberDate()) low--;
+          while (val < orderColumns.getTimestamp(low)) low--;
           findIndex = low;
         }
     }else return -1;
@@ -164,7 +271,7 @@ int OrderManager::findOrder(const long long val,const bool exact = true,const bo
   if (last) {
     bool isLast = false;
     while (!isLast) {
-      if (findIndex+1 > n-1 || orders[findIndex].getNumberDate() != orders[findIndex+1].getNumberDate()) {
+      if (findIndex+1 > n-1 || orderColumns.getTimestamp(findIndex) != orderColumns.getTimestamp(findIndex+1)) {
         isLast = true;
       } else {
         findIndex++;
@@ -174,7 +281,7 @@ int OrderManager::findOrder(const long long val,const bool exact = true,const bo
   }else {
     bool isFirst = false;
     while (!isFirst) {
-      if (findIndex-1 < 0 || orders[findIndex].getNumberDate() != orders[findIndex-1].getNumberDate()) {
+      if (findIndex-1 < 0 || orderColumns.getTimestamp(findIndex) != orderColumns.getTimestamp(findIndex-1)) {
         isFirst = true;
       } else {
         findIndex--;
@@ -243,24 +350,31 @@ void OrderManager::quickSort(Order* arr, int low, int high) {
     }
 }
 
+/*
+    funcion: sortOrders
+    Descripcion: Ordena las órdenes por fecha y reconstruye la copia columnar que usan las
+                 búsquedas y resúmenes por rango de fechas.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(n log n)
+*/
 void OrderManager::sortOrders() {
     quickSort(orders, 0, orderCount - 1);  
+    orderColumns.build(orders, orderCount);
 }
 
 /*
-    Created by Brian R. Gómez Martínez
-    funcion: filterOrdersByDate
-    Descripcion: Filtra y muestra en consola las órdenes que se encuentran dentro de un rango de fechas específico.
-                 Utiliza búsqueda binaria para encontrar los límites del rango de manera eficiente.
+    funcion: parseDateRange
+    Descripcion: Valida un rango de fechas "Mon DD [HH:MM:SS]" y lo convierte a fechas
+                 numéricas comparables con numberDate. Si la fecha de fin no trae hora se
+                 toma hasta las 23:59:59 de ese día.
     Parametros:
-        - startDate (const String &): Fecha de inicio del filtro. Formato "YY/MM/DD HH:MM:SS" o similar.
-        - endDate (const String &): Fecha de fin del filtro. Si se omite la hora, se considera hasta las 23:59:59 de ese día.
-        - details (const bool): Si es true, imprime un conteo de los resultados encontrados antes de listarlos.
-    Return: (void)
-    Complejidad: O(log n + m), donde n es el total de órdenes y m es el número de órdenes dentro del rango de fechas.
+        - startDate, endDate (const String &): Fechas de inicio y fin.
+        - start, end (long long &): Reciben las fechas numéricas.
+    Return: (void) Lanza std::invalid_argument si el formato, el mes o el rango no son válidos.
+    Complejidad: O(1)
 */
-void OrderManager::filterOrdersByDate(const String &startDate,const String &endDate, const bool details) {
-  if (orderCount == 0) throw std::invalid_argument("No orders to filter");
+void OrderManager::parseDateRange(const String &startDate, const String &endDate, long long &start, long long &end) const {
   if (startDate.length() < 5) throw std::invalid_argument("Invalid start date format");
   if (endDate.length() < 5) throw std::invalid_argument("Invalid end date format");
 
@@ -279,9 +393,29 @@ void OrderManager::filterOrdersByDate(const String &startDate,const String &endD
 
   String finalEndDate;
   finalEndDate = (endDate.length() <= 6 && endDate.length() >= 5? endDate + " 23:59:59" : endDate);
-  const long long start = convertToComparableDate(startDate.c_str()), end = convertToComparableDate(finalEndDate.c_str());
+  start = convertToComparableDate(startDate.c_str());
+  end = convertToComparableDate(finalEndDate.c_str());
 
   if (start > end) throw std::invalid_argument("Invalid date range");
+}
+
+/*
+    Created by Brian R. Gómez Martínez
+    funcion: filterOrdersByDate
+    Descripcion: Filtra y muestra en consola las órdenes que se encuentran dentro de un rango de fechas específico.
+                 Utiliza búsqueda binaria para encontrar los límites del rango de manera eficiente.
+    Parametros:
+        - startDate (const String &): Fecha de inicio del filtro. Formato "YY/MM/DD HH:MM:SS" o similar.
+        - endDate (const String &): Fecha de fin del filtro. Si se omite la hora, se considera hasta las 23:59:59 de ese día.
+        - details (const bool): Si es true, imprime un conteo de los resultados encontrados antes de listarlos.
+    Return: (void)
+    Complejidad: O(log n + m), donde n es el total de órdenes y m es el número de órdenes dentro del rango de fechas.
+*/
+void OrderManager::filterOrdersByDate(const String &startDate,const String &endDate, const bool details) {
+  if (orderCount == 0) throw std::invalid_argument("No orders to filter");
+  long long start = 0, end = 0;
+  parseDateRange(startDate, endDate, start, end);
+  if (orderColumns.size() != orderCount) orderColumns.build(orders, orderCount);
 
   const int first = findOrder(start, false, false), last = findOrder(end,false,true);
   if (first == -1 || last == -1) throw std::invalid_argument("No orders found");
@@ -300,6 +434,134 @@ void OrderManager::filterOrdersByDate(const char *startDate,const char *endDate,
   return this->filterOrdersByDate(String(startDate), String(endDate), details);
 }
 
+/*
+    funcion: filterOrders
+    Descripcion: Filtro compuesto: órdenes dentro de un rango de fechas, con precio entre
+                 minPrice y maxPrice y (opcionalmente) de un conjunto de restaurantes. Se
+                 evalúa con OrderScan sobre la copia columnar y del bitmap resultante salen
+                 tanto el listado como el resumen de precios.
+    Parametros:
+        - startDate, endDate (const String &): Rango de fechas (mismo formato que filterOrdersByDate).
+        - minPrice, maxPrice (int): Rango de precios (inclusivo).
+        - restaurantList (const String &): Nombres de restaurantes separados por coma; vacío acepta todos.
+        - details (const bool): Si es true, imprime el conteo antes del listado y el resumen al final.
+    Return: (void) Lanza std::invalid_argument si el rango no es válido o un restaurante no existe.
+    Complejidad: O(log n + m / 8 + k + r), m = órdenes en el rango de fechas, k = seleccionadas, r = restaurantes
+*/
+void OrderManager::filterOrders(const String &startDate, const String &endDate, int minPrice, int maxPrice,
+                                const String &restaurantList, const bool details) {
+  if (orderCount == 0) throw std::invalid_argument("No orders to filter");
+  if (minPrice > maxPrice) throw std::invalid_argument("Invalid price range");
+  OrderPredicate predicate = {0, 0, minPrice, maxPrice, nullptr, 0};
+  parseDateRange(startDate, endDate, predicate.fromTimestamp, predicate.toTimestamp);
+  if (orderColumns.size() != orderCount) orderColumns.build(orders, orderCount);
+
+  unsigned char* restaurantSet = nullptr;
+  if (restaurantList.length() > 0) {
+    restaurantSet = new unsigned char[restaurantsCount > 0 ? restaurantsCount : 1];
+    for (int i = 0; i < restaurantsCount; ++i) restaurantSet[i] = 0;
+
+    size_t from = 0;
+    while (from <= restaurantList.length()) {
+      size_t comma = restaurantList.find(',', from);
+      if (comma == String::npos || comma > restaurantList.length()) comma = restaurantList.length();
+      size_t nameStart = restaurantList.find_first_not_of(" ", from);
+      size_t nameEnd = comma;
+      while (nameEnd > nameStart && nameStart != String::npos && restaurantList[nameEnd - 1] == ' ') nameEnd--;
+      if (nameStart != String::npos && nameStart < nameEnd) {
+        const String name = restaurantList.substr(nameStart, nameEnd - nameStart);
+        int index = findRestaurantIndex(name);
+        if (index == -1) index = findRestaurantIndex(name + " ");
+        if (index == -1) {
+          delete[] restaurantSet;
+          throw std::invalid_argument("Unknown restaurant in filter");
+        }
+        restaurantSet[index] = 1;
+      }
+      from = comma + 1;
+    }
+    predicate.restaurantSet = restaurantSet;
+    predicate.restaurantSetSize = restaurantsCount;
+  }
+
+  const int count = orderScan.run(orderColumns, predicate);
+  delete[] restaurantSet;
+
+  int* rows = new int[count > 0 ? count : 1];
+  orderScan.toIndices(rows, count);
+  if (details) std::cout << count << " results found" << std::endl;
+  for (int i = 0; i < count; ++i) {
+    const Order &order = orders[rows[i]];
+    std::cout << order.getDate() << " " << order.getRestaurant() << " " << order.getOrder() << " " << order.getPrice() << std::endl;
+  }
+  delete[] rows;
+
+  if (details && count > 0) {
+    const OrderAggregate summary = orderScan.aggregate(orderColumns);
+    std::cout << "Ingreso total: " << summary.revenue
+              << " | Precio promedio: " << static_cast<double>(summary.revenue) / summary.count
+              << " | Minimo: " << summary.minPrice << " | Maximo: " << summary.maxPrice << std::endl;
+  }
+}
+
+/*
+    funcion: summarizeOrdersByDate
+    Descripcion: Muestra un resumen de las órdenes dentro de un rango de fechas: número de
+                 órdenes, ingreso total, precio promedio, mínimo y máximo, el restaurante con
+                 más ingresos y el platillo más pedido. Todo se calcula sobre la copia
+                 columnar: búsqueda binaria en la columna de fechas y recorridos de las
+                 columnas de precio, restaurante y platillo, sin tocar los Strings de Order.
+    Parametros:
+        - startDate (const String &): Fecha de inicio (mismo formato que filterOrdersByDate).
+        - endDate (const String &): Fecha de fin.
+    Return: (void) Lanza std::invalid_argument si el rango no es válido.
+    Complejidad: O(log n + m + r + d), m = órdenes en el rango, r = restaurantes, d = platillos
+*/
+void OrderManager::summarizeOrdersByDate(const String &startDate, const String &endDate) {
+  if (orderCount == 0) throw std::invalid_argument("No orders to summarize");
+  long long start = 0, end = 0;
+  parseDateRange(startDate, endDate, start, end);
+  if (orderColumns.size() != orderCount) orderColumns.build(orders, orderCount);
+
+  const int first = orderColumns.lowerBound(start);
+  const int last = orderColumns.upperBound(end);
+  const OrderAggregate summary = orderColumns.aggregate(first, last);
+
+  std::cout << "\n--- Resumen del rango ---" << std::endl;
+  std::cout << "Ordenes: " << summary.count << std::endl;
+  if (summary.count == 0) return;
+
+  std::cout << "Ingreso total: " << summary.revenue << std::endl;
+  std::cout << "Precio promedio: " << static_cast<double>(summary.revenue) / summary.count << std::endl;
+  std::cout << "Precio minimo: " << summary.minPrice << " | Precio maximo: " << summary.maxPrice << std::endl;
+
+  long long* revenue = new long long[restaurantsCount > 0 ? restaurantsCount : 1];
+  for (int i = 0; i < restaurantsCount; ++i) revenue[i] = 0;
+  orderColumns.revenueByRestaurant(first, last, revenue);
+  int bestRestaurant = -1;
+  for (int i = 0; i < restaurantsCount; ++i) {
+    if (revenue[i] > 0 && (bestRestaurant == -1 || revenue[i] > revenue[bestRestaurant])) bestRestaurant = i;
+  }
+  if (bestRestaurant != -1) {
+    std::cout << "Restaurante con mas ingresos: " << restaurants[bestRestaurant].getName()
+              << "(" << revenue[bestRestaurant] << ")" << std::endl;
+  }
+  delete[] revenue;
+
+  int* dishOrders = new int[dishesCount > 0 ? dishesCount : 1];
+  for (int i = 0; i < dishesCount; ++i) dishOrders[i] = 0;
+  orderColumns.ordersByDish(first, last, dishOrders);
+  int bestDish = -1;
+  for (int i = 0; i < dishesCount; ++i) {
+    if (dishOrders[i] > 0 && (bestDish == -1 || dishOrders[i] > dishOrders[bestDish])) bestDish = i;
+  }
+  if (bestDish != -1) {
+    std::cout << "Platillo mas pedido: " << dishes[bestDish].getName()
+              << " (" << dishOrders[bestDish] << " pedidos)" << std::endl;
+  }
+  delete[] dishOrders;
+}
+
 
 void OrderManager::displayOrders(const size_t from,const size_t count){
   for (int i = from; i < from + count; i++) {
@@ -337,14 +599,67 @@ void OrderManager::addDish(String name) {
     Dish dish = Dish(name);
     dishes[dishesCount] = dish;
     dishes[dishesCount].addOrder();
+    linkCatalogNode(dishNodeIds, dishNodeIdsCapacity, dishesCount, dishRestaurantGraph.obtenerOcrearNodo(name, 'P'));
     ++dishesCount;
 }
 
 Dish* OrderManager::findDish(String name) {
-    for (int i = 0; i < dishesCount; ++i) {
-        if (dishes[i].getName() == name) return &dishes[i];
+    const int index = findDishIndex(name);
+    return index >= 0 ? &dishes[index] : nullptr;
+}
+
+/*
+    funcion: findDishIndex
+    Descripcion: Busca un platillo por nombre y devuelve su índice en el catálogo,
+                 que es también su ID dentro del BST de platillos. Cada platillo tiene
+                 vértice en el grafo desde que se agrega, así que el nombre se busca en el
+                 índice hash del grafo en lugar de recorrer el catálogo.
+    Parametros:
+        - name (const String&): Nombre del platillo.
+    Return: (int) Índice del platillo, -1 si no existe.
+    Complejidad: O(1) esperado
+*/
+int OrderManager::findDishIndex(const String& name) const {
+    return catalogIndexOfNode(dishRestaurantGraph.buscarNodo(name, 'P'));
+}
+
+/*
+    funcion: recordDishOrder
+    Descripcion: Registra un pedido de un platillo: incrementa su contador (o lo agrega al
+                 catálogo si es nuevo) y, si el BST ya fue construido, mueve el platillo a
+                 la cubeta de su nuevo conteo para que el ranking siga al día.
+    Parametros:
+        - name (const String&): Nombre del platillo pedido.
+    Return: (int) Índice del platillo en el catálogo.
+    Complejidad: O(log m) esperado, donde m es el número de nodos del BST.
+*/
+int OrderManager::recordDishOrder(const String& name) {
+    int index = findDishIndex(name);
+    if (index >= 0) {
+        dishes[index].addOrder();
+    } else {
+        addDish(name);
+        index = dishesCount - 1;
     }
-    return nullptr;
+    if (dishBSTBuilt) dishBST.updateItem(index);
+    return index;
+}
+
+/*
+    funcion: cancelDishOrder
+    Descripcion: Cancela un pedido de un platillo: decrementa su contador y actualiza
+                 su posición en el BST si ya fue construido.
+    Parametros:
+        - name (const String&): Nombre del platillo.
+    Return: (bool) true si el platillo existía y tenía pedidos, false en otro caso.
+    Complejidad: O(log m) esperado, donde m es el número de nodos del BST.
+*/
+bool OrderManager::cancelDishOrder(const String& name) {
+    const int index = findDishIndex(name);
+    if (index < 0 || dishes[index].getTotalOrders() == 0) return false;
+    dishes[index].removeOrder();
+    if (dishBSTBuilt) dishBST.updateItem(index);
+    return true;
 }
 
 /*
@@ -352,15 +667,15 @@ Dish* OrderManager::findDish(String name) {
     Descripcion: Construye un árbol binario de búsqueda (BST) con todos los platillos del sistema.
                  Organiza los platillos por número de pedidos, permitiendo encontrar eficientemente
                  los platillos más solicitados. Maneja correctamente el caso de múltiples platillos
-                 con la misma cantidad de pedidos.
+                 con la misma cantidad de pedidos. Usa la carga masiva del BST, por lo que se
+                 puede volver a llamar después de cada recarga para reconstruir el ranking.
     Parametros: Ninguno
     Return: N/A
-    Complejidad: O(n * h), donde n es el número de platillos y h es la altura del BST.
+    Complejidad: O(n + c), donde n es el número de platillos y c el máximo número de pedidos.
 */
 void OrderManager::buildDishBST() {
-    for (int i = 0; i < dishesCount; ++i) {
-        dishBST.insert(dishes[i]);
-    }
+    dishBST.buildFromItems(dishes, dishesCount);
+    dishBSTBuilt = true;
 }
 
 /*
@@ -401,10 +716,8 @@ void OrderManager::printDishBSTReverse() const {
                  con el conteo máximo de pedidos.
 */
 void OrderManager::findAndPrintMostOrderedDishes() const {
-    Dish* mostOrdered = nullptr;
-    int count = 0;
-    
-    dishBST.findMostOrdered(mostOrdered, count);
+    const DishBucketView mostOrdered = dishBST.findTop();
+    const int count = mostOrdered.itemCount;
     
     if (count == 0) {
         std::cout << "No hay platillos registrados." << std::endl;
@@ -412,72 +725,269 @@ void OrderManager::findAndPrintMostOrderedDishes() const {
     }
     
     std::cout << "\n----- Platillo(s) con más pedidos -----" << std::endl;
-    std::cout << "Cantidad de pedidos: " << mostOrdered[0].getTotalOrders() << std::endl;
+    std::cout << "Cantidad de pedidos: " << mostOrdered.key << std::endl;
     
     if (count == 1) {
-        std::cout << "Platillo más solicitado: " << mostOrdered[0].getName() << std::endl;
+        std::cout << "Platillo más solicitado: " << dishes[mostOrdered.itemIds[0]].getName() << std::endl;
     } else {
         std::cout << "Los siguientes " << count << " platillos tienen la misma cantidad de pedidos:" << std::endl;
         for (int i = 0; i < count; ++i) {
-            std::cout << "  " << (i + 1) << ". " << mostOrdered[i].getName() << std::endl;
+            std::cout << "  " << (i + 1) << ". " << dishes[mostOrdered.itemIds[i]].getName() << std::endl;
         }
     }
     std::cout << "---------------------------------------------------\n" << std::endl;
-    
-    // Liberar la memoria asignada por findMostOrdered
-    delete[] mostOrdered;
 }
 
 /*
-    funcion: findAndPrintTopNDishes
-    Descripcion: Encuentra e imprime los N platillos con más pedidos, en orden descendente.
-                 Si hay empates en la posición N, incluye todos los platillos con ese número de pedidos.
-                 Esta función es útil para obtener un ranking de los platillos más populares.
+    struct: RankingLabels
+    Descripcion: Textos con los que se imprime un ranking Top N.
+*/
+struct RankingLabels {
+    const char* title;        // ej. "Platillos Más Solicitados"
+    const char* noun;         // ej. "platillos"
+    const char* unit;         // ej. "pedidos"
+    const char* emptyMessage;
+};
+
+/*
+    funcion: printTopN
+    Descripcion: Imprime los N primeros lugares de cualquier RankingTree. Los empates
+                 comparten la misma posición. Es una plantilla, así que el mismo código
+                 sirve para platillos, restaurantes y horas sin funciones virtuales.
     Parametros:
-        - n (int): Número de platillos a mostrar (aproximado si hay empates).
+        - tree (const Tree&): Ranking a consultar.
+        - catalog (const Item*): Catálogo al que se refieren los IDs del ranking.
+        - n (int): Número de lugares a mostrar (aproximado si hay empates).
+        - buffer (int*): Buffer reutilizable para los IDs.
+        - capacity (int): Tamaño del buffer.
+        - labels (const RankingLabels&): Textos del reporte.
     Return: N/A
-    Complejidad: O(h + k), donde h es la altura del BST y k es el número de platillos recolectados.
+    Complejidad: O(h + k), donde h es la altura del árbol y k es el número de elementos recolectados.
 */
-void OrderManager::findAndPrintTopNDishes(int n) const {
+template <typename KeyOf, typename Tree, typename Item>
+static void printTopN(const Tree& tree, const Item* catalog, int n, int* buffer, int capacity, const RankingLabels& labels) {
     if (n <= 0) {
-        std::cout << "El número de platillos debe ser mayor que 0." << std::endl;
+        std::cout << "El número de " << labels.noun << " debe ser mayor que 0." << std::endl;
         return;
     }
     
-    Dish* topDishes = nullptr;
-    int count = 0;
-    
-    dishBST.getTopNDishes(n, topDishes, count);
+    const int count = tree.getTopN(n, buffer, capacity);
     
     if (count == 0) {
-        std::cout << "No hay platillos registrados." << std::endl;
+        std::cout << labels.emptyMessage << std::endl;
         return;
     }
     
-    std::cout << "\n----- Top " << n << " Platillos Más Solicitados -----" << std::endl;
-    std::cout << "Se encontraron " << count << " platillos" << std::endl;
+    std::cout << "\n----- Top " << n << " " << labels.title << " -----" << std::endl;
+    std::cout << "Se encontraron " << count << " " << labels.noun << std::endl;
     std::cout << "---------------------------------------------------" << std::endl;
     
     int currentRank = 1;
-    int previousOrders = -1;
+    bool first = true;
+    auto previousKey = KeyOf::keyOf(catalog[buffer[0]]);
     
     for (int i = 0; i < count; ++i) {
-        int currentOrders = topDishes[i].getTotalOrders();
+        const Item& item = catalog[buffer[i]];
+        const auto currentKey = KeyOf::keyOf(item);
         
-        // Si el número de pedidos cambió, actualizar el ranking
-        if (currentOrders != previousOrders) {
+        // Si la llave cambió, actualizar el ranking
+        if (first || currentKey != previousKey) {
             currentRank = i + 1;
-            previousOrders = currentOrders;
+            previousKey = currentKey;
+            first = false;
         }
         
-        std::cout << currentRank << ". " << topDishes[i].getName() 
-                  << " (" << currentOrders << " pedidos)" << std::endl;
+        std::cout << currentRank << ". " << item.getName() 
+                  << " (" << currentKey << " " << labels.unit << ")" << std::endl;
     }
     
     std::cout << "---------------------------------------------------\n" << std::endl;
-    
-    // Liberar la memoria asignada por getTopNDishes
-    delete[] topDishes;
+}
+
+/*
+    funcion: findAndPrintTopNDishes
+    Descripcion: Encuentra e imprime los N platillos con más pedidos, en orden descendente.
+                 Si hay empates en la posición N, incluye todos los platillos con ese número de pedidos.
+                 Esta función es útil para obtener un ranking de los platillos más populares.
+    Parametros:
+        - n (int): Número de platillos a mostrar (aproximado si hay empates).
+    Return: N/A
+    Complejidad: O(h + k), donde h es la altura del BST y k es el número de platillos recolectados.
+*/
+void OrderManager::findAndPrintTopNDishes(int n) const {
+    const RankingLabels labels = {"Platillos Más Solicitados", "platillos", "pedidos", "No hay platillos registrados."};
+    printTopN<DishOrderKey>(dishBST, dishes, n, rankingScratch(dishesCount), dishesCount, labels);
+}
+
+/*
+    funcion: printDishRank
+    Descripcion: Imprime la posición de un platillo en el ranking de popularidad.
+    Parametros:
+        - name (const String&): Nombre del platillo.
+    Return: N/A
+    Complejidad: O(h) esperado, donde h es la altura del BST.
+*/
+void OrderManager::printDishRank(const String& name) const {
+    const int index = findDishIndex(name);
+    const int rank = dishBST.getRank(index);
+    if (rank < 0) {
+        std::cout << "Platillo '" << name << "' no encontrado en el BST." << std::endl;
+        return;
+    }
+    std::cout << name << " está en la posición " << rank << " de " << dishBST.getTotalItems()
+              << " (" << dishes[index].getTotalOrders() << " pedidos)" << std::endl;
+}
+
+/*
+    funcion: printDishesAtPercentile
+    Descripcion: Imprime los platillos que están en el percentil de popularidad indicado.
+    Parametros:
+        - percentile (double): Percentil entre 0 y 100.
+    Return: N/A
+    Complejidad: O(h + k), donde h es la altura del BST y k los platillos de la cubeta.
+*/
+void OrderManager::printDishesAtPercentile(double percentile) const {
+    const DishBucketView bucket = dishBST.getPercentile(percentile);
+    if (bucket.itemCount == 0) {
+        std::cout << "No hay platillos registrados." << std::endl;
+        return;
+    }
+    std::cout << "\n----- Percentil " << percentile << " (" << bucket.key << " pedidos) -----" << std::endl;
+    for (int i = 0; i < bucket.itemCount; ++i) {
+        std::cout << "  " << dishes[bucket.itemIds[i]].getName() << std::endl;
+    }
+    std::cout << "---------------------------------------------------\n" << std::endl;
+}
+
+/*
+    funcion: printDishCountInRange
+    Descripcion: Imprime cuántos platillos tienen entre minOrders y maxOrders pedidos.
+    Parametros:
+        - minOrders (int): Límite inferior (inclusivo).
+        - maxOrders (int): Límite superior (inclusivo).
+    Return: N/A
+    Complejidad: O(h), donde h es la altura del BST.
+*/
+void OrderManager::printDishCountInRange(int minOrders, int maxOrders) const {
+    std::cout << dishBST.countInRange(minOrders, maxOrders) << " platillos tienen entre "
+              << minOrders << " y " << maxOrders << " pedidos." << std::endl;
+}
+
+/*
+    funcion: findRestaurantIndex
+    Descripcion: Busca un restaurante por nombre y devuelve su índice en el catálogo,
+                 que es también su ID en los rankings de restaurantes. Como con los
+                 platillos, el nombre se busca en el índice hash del grafo.
+    Parametros:
+        - name (const String&): Nombre del restaurante.
+    Return: (int) Índice del restaurante, -1 si no existe.
+    Complejidad: O(1) esperado
+*/
+int OrderManager::findRestaurantIndex(const String& name) const {
+    return catalogIndexOfNode(dishRestaurantGraph.buscarNodo(name, 'R'));
+}
+
+/*
+    funcion: recordRestaurantOrder
+    Descripcion: Registra un pedido de un restaurante (lo agrega al catálogo si es nuevo)
+                 y, si los rankings ya fueron construidos, los actualiza.
+    Parametros:
+        - name (const String&): Nombre del restaurante.
+        - price (int): Precio del pedido.
+    Return: (int) Índice del restaurante en el catálogo.
+    Complejidad: O(log m) amortizado, donde m es el número de nodos del ranking.
+*/
+int OrderManager::recordRestaurantOrder(const String& name, int price) {
+    int index = findRestaurantIndex(name);
+    if (index < 0) {
+        if (restaurantsCount == restaurantsCapacity) {
+            // Crecer el catálogo; los rankings lo usan como arreglo, así que se les avisa
+            const int newCapacity = restaurantsCapacity > 0 ? restaurantsCapacity * 2 : 64;
+            Restaurant* grown = new Restaurant[newCapacity];
+            for (int i = 0; i < restaurantsCount; ++i) grown[i] = restaurants[i];
+            delete[] restaurants;
+            restaurants = grown;
+            restaurantsCapacity = newCapacity;
+            restaurantOrdersRanking.setCatalog(restaurants);
+            restaurantRevenueRanking.setCatalog(restaurants);
+        }
+        index = restaurantsCount++;
+        restaurants[index] = Restaurant(name);
+        linkCatalogNode(restaurantNodeIds, restaurantNodeIdsCapacity, index, dishRestaurantGraph.obtenerOcrearNodo(name, 'R'));
+    }
+    restaurants[index].addOrder(price);
+    if (rankingsBuilt) {
+        restaurantOrdersRanking.updateItem(index);
+        restaurantRevenueRanking.updateItem(index);
+    }
+    return index;
+}
+
+/*
+    funcion: recordHourOrder
+    Descripcion: Registra un pedido en la franja de la hora indicada.
+    Parametros:
+        - hour (int): Hora del día (0-23); otras horas se ignoran.
+    Return: N/A
+    Complejidad: O(log 24)
+*/
+void OrderManager::recordHourOrder(int hour) {
+    if (hour < 0 || hour >= HOURS_PER_DAY) return;
+    hourSlots[hour].addOrder();
+    if (rankingsBuilt) hourRanking.updateItem(hour);
+}
+
+/*
+    funcion: buildRankings
+    Descripcion: Construye los rankings de restaurantes (por pedidos y por ingresos) y el
+                 ranking de horas del día con la carga masiva del RankingTree.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(r log r), donde r es el número de restaurantes.
+*/
+void OrderManager::buildRankings() {
+    restaurantOrdersRanking.buildFromItems(restaurants, restaurantsCount);
+    restaurantRevenueRanking.buildFromItems(restaurants, restaurantsCount);
+    hourRanking.buildFromItems(hourSlots, HOURS_PER_DAY);
+    rankingsBuilt = true;
+}
+
+/*
+    funcion: findAndPrintTopNRestaurantsByOrders
+    Descripcion: Imprime los N restaurantes con más pedidos.
+    Parametros:
+        - n (int): Número de restaurantes a mostrar (aproximado si hay empates).
+    Return: N/A
+    Complejidad: O(h + k), donde h es la altura del ranking y k los restaurantes recolectados.
+*/
+void OrderManager::findAndPrintTopNRestaurantsByOrders(int n) const {
+    const RankingLabels labels = {"Restaurantes con Más Pedidos", "restaurantes", "pedidos", "No hay restaurantes registrados."};
+    printTopN<RestaurantOrderKey>(restaurantOrdersRanking, restaurants, n, rankingScratch(restaurantsCount), restaurantsCount, labels);
+}
+
+/*
+    funcion: findAndPrintTopNRestaurantsByRevenue
+    Descripcion: Imprime los N restaurantes con más ingresos.
+    Parametros:
+        - n (int): Número de restaurantes a mostrar (aproximado si hay empates).
+    Return: N/A
+    Complejidad: O(h + k), donde h es la altura del ranking y k los restaurantes recolectados.
+*/
+void OrderManager::findAndPrintTopNRestaurantsByRevenue(int n) const {
+    const RankingLabels labels = {"Restaurantes con Más Ingresos", "restaurantes", "de ingresos", "No hay restaurantes registrados."};
+    printTopN<RestaurantRevenueKey>(restaurantRevenueRanking, restaurants, n, rankingScratch(restaurantsCount), restaurantsCount, labels);
+}
+
+/*
+    funcion: printHourRanking
+    Descripcion: Imprime las horas del día ordenadas de la más a la menos concurrida.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(24)
+*/
+void OrderManager::printHourRanking() const {
+    const RankingLabels labels = {"Horas con Más Pedidos", "horas", "pedidos", "No hay pedidos registrados."};
+    printTopN<HourOrderKey>(hourRanking, hourSlots, HOURS_PER_DAY, rankingScratch(HOURS_PER_DAY), HOURS_PER_DAY, labels);
 }
 
 
@@ -485,42 +995,56 @@ void OrderManager::showDishBSTStatistics() const {
   dishBST.showStatistics();
 }
 
+/*
+    funcion: recordGraphOrder
+    Descripcion: Agrega un pedido al grafo Platillo-Restaurante mientras se cargan las
+                 órdenes. El platillo y el restaurante ya tienen vértice desde que entraron
+                 a su catálogo, así que no hay que buscar nombres en el grafo.
+    Parametros:
+        - dishIndex (int): Índice del platillo en el catálogo.
+        - restaurantIndex (int): Índice del restaurante en el catálogo.
+        - day (int): Día del pedido (MMDD), para la línea de tiempo del grafo.
+    Return: N/A
+    Complejidad: O(1) esperado
+*/
+void OrderManager::recordGraphOrder(int dishIndex, int restaurantIndex, int day) {
+    // Agregar arista Platillo <-> Restaurante
+    // Si ya existe, incrementa el peso (frecuencia de pedidos)
+    dishRestaurantGraph.agregarArista(dishNodeIds[dishIndex], restaurantNodeIds[restaurantIndex]);
+    graphTimeline.registrarPedido(dishNodeIds[dishIndex], restaurantNodeIds[restaurantIndex], day);
+}
+
 /*
     funcion: buildGraph
-    Descripcion: Construye un grafo dirigido donde los vértices son Platillos y 
+    Descripcion: Prepara el grafo donde los vértices son Platillos y 
                  Restaurantes, y las aristas representan "este platillo se vende 
                  en este restaurante". El peso de cada arista indica cuántas veces
                  se ha pedido ese platillo en ese restaurante.
+                 Las aristas ya se agregaron al cargar las órdenes (ver recordGraphOrder),
+                 así que aquí sólo se congela el grafo en forma CSR, se ordena la línea de
+                 tiempo por fechas y se calculan los índices de platillos similares y de
+                 menús parecidos (MinHash y matriz de bits).
+                 Los vértices se crean en el orden del archivo (sortOrders corre después
+                 de cargar), no en orden de fecha: los IDs que muestra imprimirGrafo y el
+                 orden de visita del DFS y del BFS dependen de ese orden.
     
     ESTRUCTURA DEL GRAFO:
     - Nodos tipo 'P': Platillos
     - Nodos tipo 'R': Restaurantes  
-    - Aristas: Platillo -> Restaurante (dirigido)
+    - Aristas: Platillo <-> Restaurante
     - Peso: Número de pedidos de ese platillo en ese restaurante
     
     Parametros: Ninguno
     Return: N/A
-    Complejidad: O(n) donde n es el número de órdenes
+    Complejidad: O(V + E + N + sum sobre restaurantes de grado^2), N = órdenes
 */
 void OrderManager::buildGraph() {
-    // Limpiar grafo anterior si existe
-    dishRestaurantGraph.limpiarGrafo();
-    
-    // Recorrer todas las órdenes y construir el grafo
-    for (int i = 0; i < orderCount; ++i) {
-        String nombrePlatillo = orders[i].getOrder();
-        String nombreRestaurante = orders[i].getRestaurant();
-        
-        // Obtener o crear nodos para platillo y restaurante
-        int idPlatillo = dishRestaurantGraph.obtenerOcrearNodo(nombrePlatillo, 'P');
-        int idRestaurante = dishRestaurantGraph.obtenerOcrearNodo(nombreRestaurante, 'R');
-        
-        // Agregar arista dirigida: Platillo -> Restaurante
-        // Si ya existe, incrementa el peso (frecuencia de pedidos)
-        if (idPlatillo >= 0 && idRestaurante >= 0) {
-            dishRestaurantGraph.agregarArista(idPlatillo, idRestaurante);
-        }
-    }
+    // Congelar el grafo en forma CSR para las consultas
+    dishRestaurantGraph.construirCSR();
+    graphTimeline.construir(dishRestaurantGraph.getNumNodos());
+    dishSimilarityIndex.construir(dishRestaurantGraph, SIMILAR_DISHES_K);
+    restaurantMenuIndex.construir(dishRestaurantGraph);
+    restaurantMenuMatrix.construir(dishRestaurantGraph);
     
     std::cout << "Grafo construido exitosamente!" << std::endl;
     dishRestaurantGraph.imprimirEstadisticas();
@@ -574,6 +1098,31 @@ void OrderManager::ejecutarBFSDesdeplatillo(const String& nombrePlatillo) const
     dishRestaurantGraph.ejecutarBFS(idPlatillo);
 }
 
+/*
+    funcion: mostrarAlcanceDesdePlatillo
+    Descripcion: Muestra cuántos platillos y restaurantes se alcanzan en cada nivel
+                 desde un platillo, usando el BFS paralelo del grafo.
+    Parametros:
+        - nombrePlatillo: Nombre del platillo desde donde iniciar el BFS
+    Return: N/A
+    Complejidad: O(V + E)
+*/
+void OrderManager::mostrarAlcanceDesdePlatillo(const String& nombrePlatillo) const {
+    int idPlatillo = dishRestaurantGraph.buscarNodoPorNombre(nombrePlatillo);
+    
+    if (idPlatillo == -1) {
+        std::cout << "Platillo '" << nombrePlatillo << "' no encontrado en el grafo." << std::endl;
+        return;
+    }
+    
+    if (dishRestaurantGraph.getTipoNodo(idPlatillo) != 'P') {
+        std::cout << "'" << nombrePlatillo << "' no es un platillo." << std::endl;
+        return;
+    }
+    
+    dishRestaurantGraph.imprimirNiveles(idPlatillo);
+}
+
 /*
     funcion: ejecutarDFSDesdeplatillo
     Descripcion: Ejecuta una búsqueda en profundidad (DFS) desde un platillo.
@@ -622,6 +1171,319 @@ void OrderManager::mostrarPlatilloMasConectado() const {
     dishRestaurantGraph.obtenerPlatilloMasConectado();
 }
 
+/*
+    funcion: mostrarPlatillosSimilares
+    Descripcion: Muestra los platillos que más se venden en los mismos restaurantes que
+                 el platillo dado, según el índice de similitud.
+    Parametros:
+        - nombrePlatillo: Nombre del platillo
+    Return: N/A
+    Complejidad: O(k)
+*/
+void OrderManager::mostrarPlatillosSimilares(const String& nombrePlatillo) const {
+    int idPlatillo = dishRestaurantGraph.buscarNodoPorNombre(nombrePlatillo);
+    
+    if (idPlatillo == -1) {
+        std::cout << "Platillo '" << nombrePlatillo << "' no encontrado en el grafo." << std::endl;
+        return;
+    }
+    
+    if (dishRestaurantGraph.getTipoNodo(idPlatillo) != 'P') {
+        std::cout << "'" << nombrePlatillo << "' no es un platillo." << std::endl;
+        return;
+    }
+    
+    dishSimilarityIndex.imprimirSimilares(dishRestaurantGraph, idPlatillo);
+}
+
+/*
+    funcion: findRestaurantNode
+    Descripcion: Busca el vértice de un restaurante por nombre. En orders.txt el nombre del
+                 restaurante incluye el espacio antes de "O:", así que si el nombre escrito
+                 no existe tal cual, se intenta también con ese espacio final.
+    Parametros:
+        - name (const String&): Nombre del restaurante.
+    Return: (int) ID del vértice, -1 si no existe.
+    Complejidad: O(1) esperado
+*/
+int OrderManager::findRestaurantNode(const String& name) const {
+    const int id = dishRestaurantGraph.buscarNodo(name, 'R');
+    if (id >= 0) return id;
+    return dishRestaurantGraph.buscarNodo(name + " ", 'R');
+}
+
+/*
+    funcion: mostrarRestaurantesConMenuParecido
+    Descripcion: Muestra los restaurantes cuyo menú más se parece al de un restaurante,
+                 usando el índice MinHash/LSH.
+    Parametros:
+        - nombreRestaurante: Nombre del restaurante
+        - n: Máximo de restaurantes a mostrar
+    Return: N/A
+    Complejidad: Sublineal en el número de restaurantes (sólo revisa candidatos LSH)
+*/
+void OrderManager::mostrarRestaurantesConMenuParecido(const String& nombreRestaurante, int n) const {
+    const int idRestaurante = findRestaurantNode(nombreRestaurante);
+    
+    if (idRestaurante == -1) {
+        std::cout << "Restaurante '" << nombreRestaurante << "' no encontrado en el grafo." << std::endl;
+        return;
+    }
+    
+    restaurantMenuIndex.imprimirSimilares(dishRestaurantGraph, idRestaurante, n);
+}
+
+/*
+    funcion: mostrarParesDeRestaurantesParecidos
+    Descripcion: Muestra los pares de restaurantes con los menús más parecidos, comparando
+                 todos los pares con la matriz de bits.
+    Parametros:
+        - n: Máximo de pares a mostrar
+    Return: N/A
+    Complejidad: O(R^2 * P / 256)
+*/
+void OrderManager::mostrarParesDeRestaurantesParecidos(int n) const {
+    restaurantMenuMatrix.imprimirParesMasParecidos(dishRestaurantGraph, n);
+}
+
+/*
+    funcion: recomendarPlatillosParaRestaurante
+    Descripcion: Recomienda platillos que el restaurante aún no vende, ordenados por su
+                 PageRank personalizado desde el restaurante.
+    Parametros:
+        - nombreRestaurante: Nombre del restaurante
+        - n: Máximo de platillos a mostrar
+    Return: N/A
+    Complejidad: O(iteraciones * (V + E) / hilos)
+*/
+void OrderManager::recomendarPlatillosParaRestaurante(const String& nombreRestaurante, int n) const {
+    const int idRestaurante = findRestaurantNode(nombreRestaurante);
+    
+    if (idRestaurante == -1) {
+        std::cout << "Restaurante '" << nombreRestaurante << "' no encontrado en el grafo." << std::endl;
+        return;
+    }
+    
+    recommender.imprimirRecomendaciones(dishRestaurantGraph, idRestaurante, 'P', n);
+}
+
+/*
+    funcion: recomendarRestaurantesParaPlatillo
+    Descripcion: Sugiere restaurantes que aún no venden el platillo, ordenados por su
+                 PageRank personalizado desde el platillo.
+    Parametros:
+        - nombrePlatillo: Nombre del platillo
+        - n: Máximo de restaurantes a mostrar
+    Return: N/A
+    Complejidad: O(iteraciones * (V + E) / hilos)
+*/
+void OrderManager::recomendarRestaurantesParaPlatillo(const String& nombrePlatillo, int n) const {
+    const int idPlatillo = dishRestaurantGraph.buscarNodo(nombrePlatillo, 'P');
+    
+    if (idPlatillo == -1) {
+        std::cout << "Platillo '" << nombrePlatillo << "' no encontrado en el grafo." << std::endl;
+        return;
+    }
+    
+    recommender.imprimirRecomendaciones(dishRestaurantGraph, idPlatillo, 'R', n);
+}
+
+/*
+    funcion: mostrarVecindario
+    Descripcion: Muestra los nodos a lo más a maxSaltos de un platillo o restaurante,
+                 siguiendo sólo aristas con al menos pesoMinimo pedidos. La búsqueda se
+                 detiene en cuanto encuentra maxResultados nodos.
+    Parametros:
+        - nombre: Nombre del platillo o restaurante de inicio
+        - maxSaltos: Distancia máxima
+        - maxResultados: Máximo de nodos a mostrar
+        - pesoMinimo: Pedidos mínimos de cada arista recorrida
+        - tipo: 'P' o 'R' para mostrar sólo ese tipo; otro valor muestra ambos
+    Return: N/A
+    Complejidad: Proporcional a la parte del grafo explorada
+*/
+void OrderManager::mostrarVecindario(const String& nombre, int maxSaltos, int maxResultados, int pesoMinimo, char tipo) const {
+    int idInicio = dishRestaurantGraph.buscarNodoPorNombre(nombre);
+    if (idInicio == -1) idInicio = findRestaurantNode(nombre);
+    
+    if (idInicio == -1) {
+        std::cout << "'" << nombre << "' no encontrado en el grafo." << std::endl;
+        return;
+    }
+    if (maxResultados <= 0) {
+        std::cout << "El número de resultados debe ser mayor que 0." << std::endl;
+        return;
+    }
+    
+    int* resultados = new int[maxResultados];
+    int* saltos = new int[maxResultados];
+    const int cuenta = dishRestaurantGraph.vecindarioKSaltos(idInicio, maxSaltos, maxResultados, pesoMinimo,
+                                                             tipo, resultados, saltos);
+    
+    std::cout << "\n===== A " << maxSaltos << " saltos de " << dishRestaurantGraph.getNombreNodo(idInicio)
+              << " (aristas con >= " << pesoMinimo << " pedidos) =====" << std::endl;
+    if (cuenta <= 0) {
+        std::cout << "  (sin resultados)" << std::endl;
+    }
+    for (int i = 0; i < cuenta; ++i) {
+        std::cout << "  [" << saltos[i] << "] " << dishRestaurantGraph.getNombreNodo(resultados[i])
+                  << " (Tipo: " << dishRestaurantGraph.getTipoNodo(resultados[i]) << ")" << std::endl;
+    }
+    if (cuenta == maxResultados) {
+        std::cout << "  (se alcanzó el límite de " << maxResultados << " resultados)" << std::endl;
+    }
+    std::cout << "================================================" << std::endl;
+    
+    delete[] resultados;
+    delete[] saltos;
+}
+
+/*
+    funcion: mostrarCentralidad
+    Descripcion: Muestra los platillos o restaurantes más centrales del grafo según grado
+                 ponderado, cercanía o intermediación. Los puntajes se calculan la primera
+                 vez que se piden y se reutilizan en las siguientes consultas.
+    Parametros:
+        - metrica: GRADO_PONDERADO, CERCANIA o INTERMEDIACION
+        - tipo: 'P' para platillos, 'R' para restaurantes
+        - n: Número de lugares a mostrar
+    Return: N/A
+    Complejidad: O(V * E / hilos) la primera vez, O(h + n) después
+*/
+void OrderManager::mostrarCentralidad(MetricaCentralidad metrica, char tipo, int n) const {
+    if (!graphCentrality.estaCalculada()) {
+        graphCentrality.calcular(dishRestaurantGraph);
+    }
+    graphCentrality.imprimirTopN(metrica, tipo, n);
+}
+
+/*
+    funcion: mostrarCaminoMasFuerte
+    Descripcion: Muestra el camino entre dos platillos o restaurantes que pasa por las
+                 relaciones más pedidas (Dijkstra con costo 1 / pedidos).
+    Parametros:
+        - nombreOrigen, nombreDestino: Nombres de los nodos
+        - bidireccional: true para buscar desde ambos extremos, false sólo desde el origen
+    Return: N/A
+    Complejidad: O((V + E) log V) en el peor caso
+*/
+void OrderManager::mostrarCaminoMasFuerte(const String& nombreOrigen, const String& nombreDestino, bool bidireccional) const {
+    int idOrigen = dishRestaurantGraph.buscarNodoPorNombre(nombreOrigen);
+    if (idOrigen == -1) idOrigen = findRestaurantNode(nombreOrigen);
+    int idDestino = dishRestaurantGraph.buscarNodoPorNombre(nombreDestino);
+    if (idDestino == -1) idDestino = findRestaurantNode(nombreDestino);
+    
+    if (idOrigen == -1) {
+        std::cout << "'" << nombreOrigen << "' no encontrado en el grafo." << std::endl;
+        return;
+    }
+    if (idDestino == -1) {
+        std::cout << "'" << nombreDestino << "' no encontrado en el grafo." << std::endl;
+        return;
+    }
+    
+    pathFinder.imprimirCamino(dishRestaurantGraph, idOrigen, idDestino, bidireccional);
+}
+
+/*
+    funcion: parseDayRange
+    Descripcion: Convierte un rango de fechas "Mon DD" a días MMDD. La validación (formato,
+                 mes y orden del rango) es la de parseDateRange.
+    Parametros:
+        - startDate, endDate (const String&): Fechas de inicio y fin
+        - startDay, endDay (int&): Reciben los días del rango
+    Return: (bool) true si el rango es válido; si no, imprime el motivo
+    Complejidad: O(1)
+*/
+bool OrderManager::parseDayRange(const String& startDate, const String& endDate, int& startDay, int& endDay) const {
+    long long start = 0;
+    long long end = 0;
+    try {
+        parseDateRange(startDate, endDate, start, end);
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Rango de fechas inválido: " << e.what() << std::endl;
+        return false;
+    }
+    startDay = dayKey(start);
+    endDay = dayKey(end);
+    return true;
+}
+
+/*
+    funcion: buscarRestaurantesDePlatilloEnFechas
+    Descripcion: Muestra los restaurantes que vendieron un platillo dentro de un rango de
+                 fechas y cuántos pedidos tuvo en cada uno, usando la línea de tiempo del
+                 grafo (no recorre las órdenes).
+    Parametros:
+        - nombrePlatillo: Nombre del platillo
+        - startDate, endDate: Rango de fechas "Mon DD" (inclusive)
+    Return: N/A
+    Complejidad: O(k * log D), k = restaurantes del platillo, D = días con pedidos
+*/
+void OrderManager::buscarRestaurantesDePlatilloEnFechas(const String& nombrePlatillo, const String& startDate, const String& endDate) const {
+    const int idPlatillo = dishRestaurantGraph.buscarNodo(nombrePlatillo, 'P');
+    if (idPlatillo == -1) {
+        std::cout << "Platillo '" << nombrePlatillo << "' no encontrado en el grafo." << std::endl;
+        return;
+    }
+    
+    int startDay = 0;
+    int endDay = 0;
+    if (!parseDayRange(startDate, endDate, startDay, endDay)) return;
+    
+    const int capacidad = dishRestaurantGraph.getGradoNodo(idPlatillo);
+    int* restaurantes = new int[capacidad > 0 ? capacidad : 1];
+    int* pedidos = new int[capacidad > 0 ? capacidad : 1];
+    const int cuenta = graphTimeline.vecinosEnVentana(idPlatillo, startDay, endDay, restaurantes, pedidos, capacidad);
+    
+    std::cout << "\n===== Restaurantes que vendieron " << nombrePlatillo << " entre "
+              << startDate << " y " << endDate << " =====" << std::endl;
+    int totalPedidos = 0;
+    for (int i = 0; i < cuenta; ++i) {
+        std::cout << "  " << dishRestaurantGraph.getNombreNodo(restaurantes[i])
+                  << " - " << pedidos[i] << " pedidos" << std::endl;
+        totalPedidos += pedidos[i];
+    }
+    if (cuenta == 0) {
+        std::cout << "  (sin pedidos en ese rango)" << std::endl;
+    } else {
+        std::cout << "-------------------------------------------" << std::endl;
+        std::cout << "Total: " << cuenta << " restaurantes, " << totalPedidos << " pedidos" << std::endl;
+    }
+    std::cout << "================================================" << std::endl;
+    
+    delete[] restaurantes;
+    delete[] pedidos;
+}
+
+/*
+    funcion: mostrarAlcanceEnFechas
+    Descripcion: Alcance por niveles desde un platillo, pero sólo sobre las aristas con
+                 pedidos dentro del rango de fechas (el grafo de ese periodo).
+    Parametros:
+        - nombrePlatillo: Nombre del platillo desde donde iniciar el BFS
+        - startDate, endDate: Rango de fechas "Mon DD" (inclusive)
+    Return: N/A
+    Complejidad: O(V + E * log D)
+*/
+void OrderManager::mostrarAlcanceEnFechas(const String& nombrePlatillo, const String& startDate, const String& endDate) const {
+    const int idPlatillo = dishRestaurantGraph.buscarNodo(nombrePlatillo, 'P');
+    if (idPlatillo == -1) {
+        std::cout << "Platillo '" << nombrePlatillo << "' no encontrado en el grafo." << std::endl;
+        return;
+    }
+    
+    int startDay = 0;
+    int endDay = 0;
+    if (!parseDayRange(startDate, endDate, startDay, endDay)) return;
+    
+    GrafoCSR ventana;
+    graphTimeline.construirVentana(startDay, endDay, ventana);
+    std::cout << "\nGrafo entre " << startDate << " y " << endDate << ": "
+              << ventana.numAristas / 2 << " aristas con pedidos" << std::endl;
+    dishRestaurantGraph.imprimirNiveles(ventana, idPlatillo);
+}
+
 /*
     funcion: getGraph
     Descripcion: Retorna una referencia al grafo para acceso directo.
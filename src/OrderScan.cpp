@@ -0,0 +1,290 @@
+#include "OrderScan.hpp"
+#include "Bits.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define ORDER_SCAN_AVX2 1
+#endif
+
+typedef void (*ScanKernel)(const int* prices, const int* restaurants, int from, int to,
+                           int minPrice, int maxPrice, const int* table, int tableSize,
+                           unsigned char* bitmapBytes);
+
+/*
+    funcion: scanScalar
+    Descripcion: Evalúa precio y restaurante en las filas [from, to) (from y to múltiplos
+                 de 8) y escribe un byte del bitmap por cada 8 filas. Las comparaciones se
+                 combinan con & para no tener saltos dependientes de los datos.
+    Parametros:
+        - prices, restaurants: Columnas de precio y restaurante
+        - from, to: Rango de filas
+        - minPrice, maxPrice: Rango de precios (inclusivo)
+        - table: -1 si el restaurante está en el conjunto, 0 si no; nullptr acepta todos
+        - tableSize: Tamaño de table
+        - bitmapBytes: Bitmap visto como bytes (byte k = filas 8k a 8k + 7)
+    Return: N/A
+    Complejidad: O(to - from)
+*/
+static void scanScalar(const int* prices, const int* restaurants, int from, int to,
+                       int minPrice, int maxPrice, const int* table, int tableSize,
+                       unsigned char* bitmapBytes) {
+    for (int block = from; block < to; block += 8) {
+        unsigned int bits = 0;
+        for (int j = 0; j < 8; ++j) {
+            const int row = block + j;
+            unsigned int pass = (prices[row] >= minPrice) & (prices[row] <= maxPrice);
+            if (table != nullptr) {
+                const int id = restaurants[row];
+                const unsigned int valid = (id >= 0) & (id < tableSize);
+                pass &= valid && table[id] != 0;
+            }
+            bits |= pass << j;
+        }
+        bitmapBytes[block / 8] = static_cast<unsigned char>(bits);
+    }
+}
+
+#ifdef ORDER_SCAN_AVX2
+/*
+    funcion: scanAVX2
+    Descripcion: Igual que scanScalar pero 8 filas por iteración: compara 8 precios a la vez,
+                 consulta los 8 restaurantes en la tabla del conjunto con un gather (enmascarado
+                 para no leer fuera de la tabla) y vpmovmskps da directamente el byte del bitmap.
+                 Se compila con target("avx2") y sólo se llama si el procesador lo soporta.
+    Parametros: Igual que scanScalar
+    Return: N/A
+    Complejidad: O((to - from) / 8)
+*/
+__attribute__((target("avx2")))
+static void scanAVX2(const int* prices, const int* restaurants, int from, int to,
+                     int minPrice, int maxPrice, const int* table, int tableSize,
+                     unsigned char* bitmapBytes) {
+    const __m256i minimum = _mm256_set1_epi32(minPrice);
+    const __m256i maximum = _mm256_set1_epi32(maxPrice);
+    const __m256i size = _mm256_set1_epi32(tableSize);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi32(-1);
+
+    for (int block = from; block < to; block += 8) {
+        const __m256i price = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prices + block));
+        const __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi32(minimum, price),
+                                                _mm256_cmpgt_epi32(price, maximum));
+        __m256i pass = _mm256_xor_si256(outside, ones);
+
+        if (table != nullptr) {
+            const __m256i id = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(restaurants + block));
+            const __m256i valid = _mm256_andnot_si256(_mm256_cmpgt_epi32(zero, id), _mm256_cmpgt_epi32(size, id));
+            const __m256i member = _mm256_mask_i32gather_epi32(zero, table, id, valid, 4);
+            pass = _mm256_and_si256(pass, member);
+        }
+
+        bitmapBytes[block / 8] = static_cast<unsigned char>(_mm256_movemask_ps(_mm256_castsi256_ps(pass)));
+    }
+}
+#endif
+
+/*
+    funcion: chooseKernel
+    Descripcion: Elige una sola vez el kernel de evaluación según el procesador. Se llama
+                 durante la inicialización estática, así que primero inicializa la detección
+                 de CPU.
+    Return: Puntero al kernel AVX2 si está disponible, si no al escalar
+    Complejidad: O(1)
+*/
+static ScanKernel chooseKernel() {
+#ifdef ORDER_SCAN_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return scanAVX2;
+#endif
+    return scanScalar;
+}
+
+static const ScanKernel scanKernel = chooseKernel();
+
+/*
+    funcion: OrderScan (Constructor)
+    Descripcion: Inicializa un escaneo sin resultados.
+    Complejidad: O(1)
+*/
+OrderScan::OrderScan()
+    : bitmap(nullptr), bitmapWords(0), restaurantTable(nullptr), restaurantTableSize(0),
+      firstRow(0), lastRow(0), selected(0) {
+}
+
+/*
+    funcion: ~OrderScan (Destructor)
+    Descripcion: Libera el bitmap y la tabla del conjunto de restaurantes.
+    Complejidad: O(1)
+*/
+OrderScan::~OrderScan() {
+    delete[] bitmap;
+    delete[] restaurantTable;
+}
+
+/*
+    funcion: prepare
+    Descripcion: Asegura espacio para el bitmap, limpia las palabras del rango de filas y
+                 expande el conjunto de restaurantes a la tabla de enteros del gather.
+    Parametros:
+        - rows (int): Filas de las columnas.
+        - predicate (const OrderPredicate&): Filtro a evaluar.
+    Return: N/A
+    Complejidad: O(palabras del rango + tamaño del conjunto)
+*/
+void OrderScan::prepare(int rows, const OrderPredicate& predicate) {
+    const int words = (rows + 63) / 64;
+    if (words > bitmapWords) {
+        delete[] bitmap;
+        bitmap = new unsigned long long[words];
+        bitmapWords = words;
+    }
+    if (firstRow < lastRow) {
+        for (int w = firstRow / 64; w <= (lastRow - 1) / 64; ++w) {
+            bitmap[w] = 0;
+        }
+    }
+
+    if (predicate.restaurantSet != nullptr && predicate.restaurantSetSize > restaurantTableSize) {
+        delete[] restaurantTable;
+        restaurantTable = new int[predicate.restaurantSetSize];
+        restaurantTableSize = predicate.restaurantSetSize;
+    }
+    if (predicate.restaurantSet != nullptr) {
+        for (int i = 0; i < predicate.restaurantSetSize; ++i) {
+            restaurantTable[i] = predicate.restaurantSet[i] ? -1 : 0;
+        }
+    }
+}
+
+/*
+    funcion: run
+    Descripcion: Evalúa el filtro sobre todas las órdenes y guarda la selección.
+
+    ALGORITMO:
+    1. Rango de fechas: [lowerBound(desde), upperBound(hasta)) en la columna ordenada
+    2. Filas sueltas al inicio y al final del rango (hasta alinear a 8): escalar, bit por bit
+    3. Bloques de 8 filas: kernel AVX2 o escalar, un byte del bitmap por bloque
+    4. Conteo: popcount de las palabras del rango
+
+    Parametros:
+        - columns (const OrderColumns&): Órdenes en columnas.
+        - predicate (const OrderPredicate&): Filtro a evaluar.
+    Return: (int) Filas seleccionadas
+    Complejidad: O(log n + m / 8) con AVX2, O(log n + m) escalar; m = filas en el rango de fechas
+*/
+int OrderScan::run(const OrderColumns& columns, const OrderPredicate& predicate) {
+    firstRow = columns.lowerBound(predicate.fromTimestamp);
+    lastRow = columns.upperBound(predicate.toTimestamp);
+    if (lastRow < firstRow) lastRow = firstRow;
+    prepare(columns.size(), predicate);
+    selected = 0;
+    if (predicate.restaurantSet != nullptr && predicate.restaurantSetSize <= 0) {
+        lastRow = firstRow;  // Conjunto vacío: ninguna fila pasa
+    }
+    if (firstRow == lastRow) return 0;
+
+    const int* prices = columns.priceColumn();
+    const int* restaurants = columns.restaurantColumn();
+    const int* table = predicate.restaurantSet != nullptr ? restaurantTable : nullptr;
+    const int tableSize = predicate.restaurantSet != nullptr ? predicate.restaurantSetSize : 0;
+
+    int blockStart = (firstRow + 7) / 8 * 8;
+    int blockEnd = lastRow / 8 * 8;
+    if (blockStart > blockEnd) blockStart = blockEnd = lastRow;
+
+    // Filas sueltas fuera de los bloques de 8
+    for (int row = firstRow; row < lastRow; ++row) {
+        if (row == blockStart) row = blockEnd;
+        if (row >= lastRow) break;
+        bool pass = prices[row] >= predicate.minPrice && prices[row] <= predicate.maxPrice;
+        if (pass && table != nullptr) {
+            const int id = restaurants[row];
+            pass = id >= 0 && id < tableSize && table[id] != 0;
+        }
+        if (pass) bitmap[row / 64] |= 1ULL << (row % 64);
+    }
+
+    if (blockStart < blockEnd) {
+        scanKernel(prices, restaurants, blockStart, blockEnd, predicate.minPrice, predicate.maxPrice,
+                   table, tableSize, reinterpret_cast<unsigned char*>(bitmap));
+    }
+
+    for (int w = firstRow / 64; w <= (lastRow - 1) / 64; ++w) {
+        selected += contarBits(bitmap[w]);
+    }
+    return selected;
+}
+
+/*
+    funcion: selectedCount
+    Descripcion: Filas seleccionadas por el último run.
+    Return: (int) Número de filas
+    Complejidad: O(1)
+*/
+int OrderScan::selectedCount() const {
+    return selected;
+}
+
+/*
+    funcion: isSelected
+    Descripcion: Indica si una fila pasó el último filtro.
+    Parametros:
+        - row (int): Índice de la fila.
+    Return: (bool) true si está seleccionada
+    Complejidad: O(1)
+*/
+bool OrderScan::isSelected(int row) const {
+    if (row < firstRow || row >= lastRow) return false;
+    return (bitmap[row / 64] >> (row % 64)) & 1ULL;
+}
+
+/*
+    funcion: toIndices
+    Descripcion: Convierte el bitmap en la lista de filas seleccionadas, en orden. Salta las
+                 palabras vacías y extrae cada bit encendido con ctz.
+    Parametros:
+        - indices (int*): Buffer de salida.
+        - capacity (int): Tamaño del buffer; las filas que no caben no se escriben.
+    Return: (int) Número de filas seleccionadas
+    Complejidad: O(m / 64 + seleccionadas)
+*/
+int OrderScan::toIndices(int* indices, int capacity) const {
+    int count = 0;
+    if (firstRow == lastRow) return 0;
+    for (int w = firstRow / 64; w <= (lastRow - 1) / 64; ++w) {
+        unsigned long long word = bitmap[w];
+        while (word != 0) {
+            if (count < capacity) indices[count] = w * 64 + bitMasBajo(word);
+            count++;
+            word &= word - 1;
+        }
+    }
+    return count;
+}
+
+/*
+    funcion: aggregate
+    Descripcion: Conteo, suma, mínimo y máximo de precio de las filas seleccionadas.
+    Parametros:
+        - columns (const OrderColumns&): Las mismas columnas del último run.
+    Return: (OrderAggregate) Resumen de la selección
+    Complejidad: O(m / 64 + seleccionadas)
+*/
+OrderAggregate OrderScan::aggregate(const OrderColumns& columns) const {
+    OrderAggregate result = {0, 0, 0, 0};
+    if (firstRow == lastRow) return result;
+
+    const int* prices = columns.priceColumn();
+    for (int w = firstRow / 64; w <= (lastRow - 1) / 64; ++w) {
+        unsigned long long word = bitmap[w];
+        while (word != 0) {
+            const int price = prices[w * 64 + bitMasBajo(word)];
+            if (result.count == 0 || price < result.minPrice) result.minPrice = price;
+            if (result.count == 0 || price > result.maxPrice) result.maxPrice = price;
+            result.revenue += price;
+            result.count++;
+            word &= word - 1;
+        }
+    }
+    return result;
+}
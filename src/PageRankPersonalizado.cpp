@@ -0,0 +1,208 @@
+#include "PageRankPersonalizado.hpp"
+#include "Hilos.hpp"
+#include "TopK.hpp"
+#include <cmath>
+#include <iostream>
+
+/*
+    funcion: PageRankPersonalizado (Constructor)
+    Descripcion: Fija los parámetros de la caminata aleatoria.
+    Parametros:
+        - alfa: Probabilidad de seguir una arista en cada paso (default 0.85)
+        - tolerancia: Cambio L1 con el que se considera convergido (default 1e-6)
+        - maxIteraciones: Límite de iteraciones (default 100)
+    Complejidad: O(1)
+*/
+PageRankPersonalizado::PageRankPersonalizado(double alfa, double tolerancia, int maxIteraciones)
+    : alfa(alfa), tolerancia(tolerancia), maxIteraciones(maxIteraciones) {
+}
+
+/*
+    funcion: calcular
+    Descripcion: Calcula el PageRank personalizado con reinicio en nodoOrigen.
+
+    ALGORITMO (iteración de potencia, modo pull):
+    1. r = e_origen; W(u) = suma de pesos de u
+    2. Repetir hasta converger:
+       nuevo[v] = alfa * suma sobre vecinos u de v de r[u] * peso(u, v) / W(u)
+       más (1 - alfa + alfa * masa de nodos sin aristas) en el origen
+    3. Parar cuando suma |nuevo - r| < tolerancia
+
+    Cada hilo calcula un rango contiguo de nodos y su parte del cambio L1; al final de
+    cada iteración se suman las partes y se intercambian los arreglos.
+
+    Parametros:
+        - grafo: Grafo Platillo-Restaurante
+        - nodoOrigen: Nodo de reinicio (el "usuario" de la recomendación)
+        - puntajes: Arreglo de numNodos; recibe la probabilidad de cada nodo
+        - numHilos: Hilos a usar; 0 usa todos los núcleos
+    Return: Número de iteraciones realizadas, -1 si el nodo es inválido
+    Complejidad: O(iteraciones * (V + E) / hilos)
+*/
+int PageRankPersonalizado::calcular(const Graph& grafo, int nodoOrigen, double* puntajes, int numHilos) const {
+    const int n = grafo.getNumNodos();
+    if (nodoOrigen < 0 || nodoOrigen >= n) return -1;
+
+    const GrafoCSR& g = grafo.obtenerCSR();
+    const int hilos = hilosParaTrabajo(numeroDeHilos(numHilos), n + static_cast<long long>(g.numAristas), 1 << 15);
+
+    double* inversoPeso = new double[n];  // 1 / W(u), 0 si u no tiene aristas
+    double* actual = puntajes;
+    double* siguiente = new double[n];
+    double* cambioPorHilo = new double[hilos];
+    double* sinSalidaPorHilo = new double[hilos];
+
+    ejecutarEnHilos(hilos, [&](int h) {
+        const int inicio = static_cast<int>(static_cast<long long>(n) * h / hilos);
+        const int fin = static_cast<int>(static_cast<long long>(n) * (h + 1) / hilos);
+        for (int u = inicio; u < fin; ++u) {
+            const int pesoTotal = grafo.getPesoNodo(u);
+            inversoPeso[u] = pesoTotal > 0 ? 1.0 / static_cast<double>(pesoTotal) : 0.0;
+            actual[u] = 0.0;
+        }
+    });
+    actual[nodoOrigen] = 1.0;
+    double masaSinSalida = (inversoPeso[nodoOrigen] == 0.0) ? 1.0 : 0.0;
+
+    int iteracion = 0;
+    while (iteracion < maxIteraciones) {
+        const double reinicio = (1.0 - alfa) + alfa * masaSinSalida;
+
+        ejecutarEnHilos(hilos, [&](int h) {
+            const int inicio = static_cast<int>(static_cast<long long>(n) * h / hilos);
+            const int fin = static_cast<int>(static_cast<long long>(n) * (h + 1) / hilos);
+            double cambio = 0.0;
+            double sinSalida = 0.0;
+            for (int v = inicio; v < fin; ++v) {
+                double suma = 0.0;
+                for (int k = g.offsets[v]; k < g.offsets[v + 1]; ++k) {
+                    const int u = g.vecinos[k];
+                    suma += actual[u] * g.pesos[k] * inversoPeso[u];
+                }
+                double valor = alfa * suma;
+                if (v == nodoOrigen) valor += reinicio;
+                siguiente[v] = valor;
+                cambio += std::fabs(valor - actual[v]);
+                if (inversoPeso[v] == 0.0) sinSalida += valor;
+            }
+            cambioPorHilo[h] = cambio;
+            sinSalidaPorHilo[h] = sinSalida;
+        });
+
+        double cambioTotal = 0.0;
+        masaSinSalida = 0.0;
+        for (int h = 0; h < hilos; ++h) {
+            cambioTotal += cambioPorHilo[h];
+            masaSinSalida += sinSalidaPorHilo[h];
+        }
+
+        double* temporal = actual;
+        actual = siguiente;
+        siguiente = temporal;
+        iteracion++;
+
+        if (cambioTotal < tolerancia) break;
+    }
+
+    // El resultado debe quedar en el arreglo del llamador
+    if (actual != puntajes) {
+        for (int i = 0; i < n; ++i) {
+            puntajes[i] = actual[i];
+        }
+        siguiente = actual;
+    }
+
+    delete[] inversoPeso;
+    delete[] siguiente;
+    delete[] cambioPorHilo;
+    delete[] sinSalidaPorHilo;
+
+    return iteracion;
+}
+
+/*
+    funcion: tieneMayorPuntaje
+    Descripcion: Orden de las recomendaciones: mayor puntaje primero. En empate se queda
+                 la que llegó antes (menor ID de nodo).
+    Parametros:
+        - a, b: Recomendaciones a comparar
+    Return: true si 'a' va antes que 'b'
+    Complejidad: O(1)
+*/
+static bool tieneMayorPuntaje(const Recomendacion& a, const Recomendacion& b) {
+    return a.puntaje > b.puntaje;
+}
+
+/*
+    funcion: recomendar
+    Descripcion: Obtiene los nodos del tipo pedido con mayor PageRank personalizado desde
+                 el origen, omitiendo el origen y sus vecinos directos (lo que ya vende
+                 el restaurante, o los restaurantes que ya venden el platillo).
+    Parametros:
+        - grafo: Grafo Platillo-Restaurante
+        - nodoOrigen: Nodo para el que se recomienda
+        - tipo: 'P' para recomendar platillos, 'R' para restaurantes
+        - resultado: Buffer de recomendaciones, de mayor a menor puntaje
+        - capacidad: Máximo de recomendaciones
+    Return: Número de recomendaciones escritas, -1 si el nodo es inválido
+    Complejidad: O(iteraciones * (V + E) / hilos + V * capacidad)
+*/
+int PageRankPersonalizado::recomendar(const Graph& grafo, int nodoOrigen, char tipo, Recomendacion* resultado, int capacidad) const {
+    const int n = grafo.getNumNodos();
+    if (nodoOrigen < 0 || nodoOrigen >= n) return -1;
+
+    double* puntajes = new double[n];
+    calcular(grafo, nodoOrigen, puntajes);
+
+    // Excluir el origen y lo que ya está conectado a él
+    const GrafoCSR& g = grafo.obtenerCSR();
+    puntajes[nodoOrigen] = -1.0;
+    for (int k = g.offsets[nodoOrigen]; k < g.offsets[nodoOrigen + 1]; ++k) {
+        puntajes[g.vecinos[k]] = -1.0;
+    }
+
+    int cuenta = 0;
+    for (int v = 0; v < n && capacidad > 0; ++v) {
+        if (puntajes[v] <= 0.0 || grafo.getTipoNodo(v) != tipo) continue;
+        Recomendacion candidato;
+        candidato.nodo = v;
+        candidato.puntaje = puntajes[v];
+        insertarEnTop(resultado, cuenta, capacidad, candidato, tieneMayorPuntaje);
+    }
+
+    delete[] puntajes;
+    return cuenta;
+}
+
+/*
+    funcion: imprimirRecomendaciones
+    Descripcion: Muestra las recomendaciones de PageRank personalizado para un nodo.
+    Parametros:
+        - grafo: Grafo Platillo-Restaurante
+        - nodoOrigen: Nodo para el que se recomienda
+        - tipo: 'P' para recomendar platillos, 'R' para restaurantes
+        - n: Máximo de recomendaciones a mostrar
+    Complejidad: La de recomendar
+*/
+void PageRankPersonalizado::imprimirRecomendaciones(const Graph& grafo, int nodoOrigen, char tipo, int n) const {
+    if (n <= 0) {
+        std::cout << "El número de recomendaciones debe ser mayor que 0." << std::endl;
+        return;
+    }
+
+    Recomendacion* recomendaciones = new Recomendacion[n];
+    const int cuenta = recomendar(grafo, nodoOrigen, tipo, recomendaciones, n);
+
+    std::cout << "\n===== " << (tipo == 'P' ? "Platillos recomendados para: " : "Restaurantes sugeridos para: ")
+              << grafo.getNombreNodo(nodoOrigen) << " =====" << std::endl;
+    if (cuenta <= 0) {
+        std::cout << "  (sin recomendaciones)" << std::endl;
+    }
+    for (int i = 0; i < cuenta; ++i) {
+        std::cout << "  " << i + 1 << ". " << grafo.getNombreNodo(recomendaciones[i].nodo)
+                  << " (puntaje " << recomendaciones[i].puntaje << ")" << std::endl;
+    }
+    std::cout << "================================================" << std::endl;
+
+    delete[] recomendaciones;
+}
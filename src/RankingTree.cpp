@@ -0,0 +1,9 @@
+#include "RankingTreeImpl.hpp"
+#include "DishBST.hpp"
+#include "Rankings.hpp"
+
+// Instancias de los rankings de pedidos; las de centralidad están en Centralidad.cpp
+template class RankingTree<Dish, int, DishOrderKey>;
+template class RankingTree<Restaurant, int, RestaurantOrderKey>;
+template class RankingTree<Restaurant, long long, RestaurantRevenueKey>;
+template class RankingTree<HourSlot, int, HourOrderKey>;
@@ -0,0 +1,85 @@
+#include "Restaurant.hpp"
+
+/*
+    funcion: Restaurant (Constructor por defecto)
+    Descripcion: Inicializa un restaurante con nombre vacío, sin pedidos ni ingresos.
+    Parametros: Ninguno
+    Return: N/A
+    Complejidad: O(1)
+*/
+Restaurant::Restaurant() {
+    name = "";
+}
+
+/*
+    funcion: Restaurant (Constructor con nombre)
+    Descripcion: Inicializa un restaurante con un nombre específico, sin pedidos ni ingresos.
+    Parametros:
+        - name (String): Nombre del restaurante.
+    Return: N/A
+    Complejidad: O(1)
+*/
+Restaurant::Restaurant(String name) {
+    this->name = name;
+}
+
+/*
+    funcion: getName
+    Descripcion: Devuelve el nombre del restaurante.
+    Parametros: Ninguno
+    Return: (String) Nombre del restaurante.
+    Complejidad: O(1)
+*/
+String Restaurant::getName() const {
+    return name;
+}
+
+/*
+    funcion: getTotalOrders
+    Descripcion: Obtiene la cantidad total de pedidos registrados en el restaurante.
+    Parametros: Ninguno
+    Return: (int) Número total de pedidos.
+    Complejidad: O(1)
+*/
+int Restaurant::getTotalOrders() const {
+    return totalOrders;
+}
+
+/*
+    funcion: getRevenue
+    Descripcion: Obtiene la suma de los precios de todos los pedidos del restaurante.
+    Parametros: Ninguno
+    Return: (long long) Ingresos totales.
+    Complejidad: O(1)
+*/
+long long Restaurant::getRevenue() const {
+    return revenue;
+}
+
+/*
+    funcion: addOrder
+    Descripcion: Registra un pedido: incrementa el contador y suma su precio a los ingresos.
+    Parametros:
+        - price (int): Precio del pedido.
+    Return: N/A
+    Complejidad: O(1)
+*/
+void Restaurant::addOrder(int price) {
+    totalOrders++;
+    revenue += price;
+}
+
+/*
+    funcion: removeOrder
+    Descripcion: Cancela un pedido: decrementa el contador y resta su precio de los ingresos.
+                 El contador nunca baja de cero.
+    Parametros:
+        - price (int): Precio del pedido cancelado.
+    Return: N/A
+    Complejidad: O(1)
+*/
+void Restaurant::removeOrder(int price) {
+    if (totalOrders == 0) return;
+    totalOrders--;
+    revenue -= price;
+}
@@ -61,6 +61,7 @@ int main() {
   cout << "---------------------------------------------------" << endl;
   cout << "\nConstruyendo BST de platillos..." << endl;
   manager.buildDishBST();
+  manager.buildRankings();
   cout << "BST construido exitosamente!" << endl;
   
   bool continuarAnalisis = true;
@@ -70,9 +71,15 @@ int main() {
     cout << "2. Mostrar Top N platillos más solicitados" << endl;
     cout << "3. Mostrar BST completo (orden ascendente)" << endl;
     cout << "4. Mostrar BST completo (orden descendente)" << endl;
-    cout << "5. Ir al análisis con Grafos" << endl;
-    cout << "6. Continuar con búsqueda por fechas" << endl;
-    cout << "Selecciona una opción (1-6): ";
+    cout << "5. Consultar posición de un platillo en el ranking" << endl;
+    cout << "6. Mostrar platillos en un percentil de popularidad" << endl;
+    cout << "7. Contar platillos en un rango de pedidos" << endl;
+    cout << "8. Mostrar Top N restaurantes por pedidos" << endl;
+    cout << "9. Mostrar Top N restaurantes por ingresos" << endl;
+    cout << "10. Mostrar ranking por hora del día" << endl;
+    cout << "11. Ir al análisis con Grafos" << endl;
+    cout << "12. Continuar con búsqueda por fechas" << endl;
+    cout << "Selecciona una opción (1-12): ";
     
     String opcionAnalisis;
     getline(cin, opcionAnalisis);
@@ -90,8 +97,34 @@ int main() {
     } else if (opcionAnalisis == "4") {
       manager.printDishBSTReverse();
     } else if (opcionAnalisis == "5") {
-      break;
+      cout << "\nIngresa el nombre del platillo: ";
+      String nombrePlatillo;
+      getline(cin, nombrePlatillo);
+      manager.printDishRank(nombrePlatillo);
     } else if (opcionAnalisis == "6") {
+      cout << "\nPercentil (0-100): ";
+      String pStr;
+      getline(cin, pStr);
+      manager.printDishesAtPercentile(std::atof(pStr.c_str()));
+    } else if (opcionAnalisis == "7") {
+      cout << "\nMínimo de pedidos: ";
+      String minStr, maxStr;
+      getline(cin, minStr);
+      cout << "Máximo de pedidos: ";
+      getline(cin, maxStr);
+      manager.printDishCountInRange(std::atoi(minStr.c_str()), std::atoi(maxStr.c_str()));
+    } else if (opcionAnalisis == "8" || opcionAnalisis == "9") {
+      cout << "\nCuantos restaurantes deseas ver? ";
+      String nStr;
+      getline(cin, nStr);
+      int n = std::atoi(nStr.c_str());
+      if (opcionAnalisis == "8") manager.findAndPrintTopNRestaurantsByOrders(n);
+      else manager.findAndPrintTopNRestaurantsByRevenue(n);
+    } else if (opcionAnalisis == "10") {
+      manager.printHourRanking();
+    } else if (opcionAnalisis == "11") {
+      break;
+    } else if (opcionAnalisis == "12") {
       continuarAnalisis = false;
     } else {
       cout << "Opción no válida. Intenta de nuevo." << endl;
@@ -114,8 +147,19 @@ int main() {
       cout << "4. Ejecutar BFS desde un platillo" << endl;
       cout << "5. Ejecutar DFS desde un platillo" << endl;
       cout << "6. Ver platillo más conectado (más restaurantes)" << endl;
-      cout << "7. Continuar con búsqueda por fechas" << endl;
-      cout << "Selecciona una opción (1-7): ";
+      cout << "7. Ver alcance por niveles desde un platillo" << endl;
+      cout << "8. Ver platillos similares (vendidos en los mismos restaurantes)" << endl;
+      cout << "9. Ver restaurantes con menú parecido" << endl;
+      cout << "10. Recomendar platillos para un restaurante" << endl;
+      cout << "11. Sugerir restaurantes para un platillo" << endl;
+      cout << "12. Buscar restaurantes de un platillo en un rango de fechas" << endl;
+      cout << "13. Ver alcance por niveles en un rango de fechas" << endl;
+      cout << "14. Ver pares de restaurantes con menús más parecidos" << endl;
+      cout << "15. Buscar vecinos a k saltos (con filtros)" << endl;
+      cout << "16. Ver nodos más centrales" << endl;
+      cout << "17. Buscar camino más fuerte entre dos nodos" << endl;
+      cout << "18. Continuar con búsqueda por fechas" << endl;
+      cout << "Selecciona una opción (1-18): ";
       
       String opcionGrafo;
       getline(cin, opcionGrafo);
@@ -142,6 +186,88 @@ int main() {
       } else if (opcionGrafo == "6") {
         manager.mostrarPlatilloMasConectado();
       } else if (opcionGrafo == "7") {
+        cout << "\nIngresa el nombre del platillo: ";
+        String nombrePlatillo;
+        getline(cin, nombrePlatillo);
+        manager.mostrarAlcanceDesdePlatillo(nombrePlatillo);
+      } else if (opcionGrafo == "8") {
+        cout << "\nIngresa el nombre del platillo: ";
+        String nombrePlatillo;
+        getline(cin, nombrePlatillo);
+        manager.mostrarPlatillosSimilares(nombrePlatillo);
+      } else if (opcionGrafo == "9") {
+        cout << "\nIngresa el nombre del restaurante: ";
+        String nombreRestaurante;
+        getline(cin, nombreRestaurante);
+        manager.mostrarRestaurantesConMenuParecido(nombreRestaurante, 10);
+      } else if (opcionGrafo == "10") {
+        cout << "\nIngresa el nombre del restaurante: ";
+        String nombreRestaurante;
+        getline(cin, nombreRestaurante);
+        manager.recomendarPlatillosParaRestaurante(nombreRestaurante, 10);
+      } else if (opcionGrafo == "11") {
+        cout << "\nIngresa el nombre del platillo: ";
+        String nombrePlatillo;
+        getline(cin, nombrePlatillo);
+        manager.recomendarRestaurantesParaPlatillo(nombrePlatillo, 10);
+      } else if (opcionGrafo == "12" || opcionGrafo == "13") {
+        cout << "\nIngresa el nombre del platillo: ";
+        String nombrePlatillo;
+        getline(cin, nombrePlatillo);
+        cout << "Fecha de inicio (ej: 'Feb 1'): ";
+        String fechaInicio;
+        getline(cin, fechaInicio);
+        cout << "Fecha de fin (ej: 'Feb 7'): ";
+        String fechaFin;
+        getline(cin, fechaFin);
+        if (opcionGrafo == "12") {
+          manager.buscarRestaurantesDePlatilloEnFechas(nombrePlatillo, fechaInicio, fechaFin);
+        } else {
+          manager.mostrarAlcanceEnFechas(nombrePlatillo, fechaInicio, fechaFin);
+        }
+      } else if (opcionGrafo == "14") {
+        manager.mostrarParesDeRestaurantesParecidos(10);
+      } else if (opcionGrafo == "15") {
+        cout << "\nIngresa el nombre del platillo o restaurante: ";
+        String nombre;
+        getline(cin, nombre);
+        cout << "Saltos máximos: ";
+        String saltos;
+        getline(cin, saltos);
+        cout << "Resultados máximos: ";
+        String resultados;
+        getline(cin, resultados);
+        cout << "Pedidos mínimos por arista: ";
+        String pedidos;
+        getline(cin, pedidos);
+        cout << "Tipo a mostrar (P = platillos, R = restaurantes, vacío = ambos): ";
+        String tipo;
+        getline(cin, tipo);
+        manager.mostrarVecindario(nombre, std::atoi(saltos.c_str()), std::atoi(resultados.c_str()),
+                                  std::atoi(pedidos.c_str()), tipo.length() > 0 ? tipo[0] : ' ');
+      } else if (opcionGrafo == "16") {
+        cout << "\nMétrica (1 = grado ponderado, 2 = cercanía, 3 = intermediación): ";
+        String metrica;
+        getline(cin, metrica);
+        cout << "Tipo (P = platillos, R = restaurantes): ";
+        String tipo;
+        getline(cin, tipo);
+        MetricaCentralidad elegida = GRADO_PONDERADO;
+        if (metrica == "2") elegida = CERCANIA;
+        else if (metrica == "3") elegida = INTERMEDIACION;
+        manager.mostrarCentralidad(elegida, (tipo.length() > 0 && tipo[0] == 'R') ? 'R' : 'P', 10);
+      } else if (opcionGrafo == "17") {
+        cout << "\nIngresa el nombre del platillo o restaurante de origen: ";
+        String origen;
+        getline(cin, origen);
+        cout << "Ingresa el nombre del platillo o restaurante de destino: ";
+        String destino;
+        getline(cin, destino);
+        cout << "Algoritmo (1 = Dijkstra, 2 = Dijkstra bidireccional): ";
+        String algoritmo;
+        getline(cin, algoritmo);
+        manager.mostrarCaminoMasFuerte(origen, destino, algoritmo != "1");
+      } else if (opcionGrafo == "18") {
         continuarGrafos = false;
       } else {
         cout << "Opción no válida. Intenta de nuevo." << endl;
@@ -180,6 +306,7 @@ int main() {
   cout << "\n--- Resultados dentro del rango ---" << endl;
   try {
     manager.filterOrdersByDate(startDate, endDate,true); 
+    manager.summarizeOrdersByDate(startDate, endDate);
   } catch (const std::exception &ex) {
     cerr << "Error en la busqueda: " << ex.what() << endl;
     return 1;
@@ -214,6 +341,31 @@ int main() {
     cout << "Resultados guardados en '" << outName << "'.\n";
   }
 
+  cout << "\n¿Deseas filtrar además por precio y restaurante? (s/n): ";
+  String opcionFiltro;
+  getline(cin, opcionFiltro);
+
+  if (opcionFiltro == "s" || opcionFiltro == "S") {
+    cout << "Precio minimo: ";
+    String minPrice;
+    getline(cin, minPrice);
+    cout << "Precio maximo: ";
+    String maxPrice;
+    getline(cin, maxPrice);
+    cout << "Restaurantes separados por coma (vacío = todos): ";
+    String restaurantes;
+    getline(cin, restaurantes);
+
+    cout << "\n--- Resultados del filtro ---" << endl;
+    try {
+      manager.filterOrders(startDate, endDate, std::atoi(minPrice.c_str()), std::atoi(maxPrice.c_str()),
+                           restaurantes, true);
+    } catch (const std::exception &ex) {
+      cerr << "Error en el filtro: " << ex.what() << endl;
+      return 1;
+    }
+  }
+
   cout << "\nListo.\n";
   return 0;
 }